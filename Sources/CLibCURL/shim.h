@@ -77,11 +77,26 @@ static CURLcode _NWG_curl_easy_set_http_method_to_put(CURL * _Nonnull curl) {
   return curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L);
 }
 
+typedef enum _NWGCURLHTTPVersion {
+  NWGCURLHTTPVersionDefault = CURL_HTTP_VERSION_NONE,
+  NWGCURLHTTPVersion1_0 = CURL_HTTP_VERSION_1_0,
+  NWGCURLHTTPVersion1_1 = CURL_HTTP_VERSION_1_1,
+  NWGCURLHTTPVersion2 = CURL_HTTP_VERSION_2_0,
+} NWGCURLHTTPVersion;
+
+static CURLcode _NWG_curl_easy_set_http_version(CURL * _Nonnull curl, NWGCURLHTTPVersion version) {
+  return curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, (long)version);
+}
+
 static CURLcode _NWG_curl_easy_set_http_request_headers(CURL * _Nonnull curl,
                                                         const CCURLStringList * _Nullable headers) {
   return curl_easy_setopt(curl, CURLOPT_HTTPHEADER, (CCURLStringList *)headers);
 }
 
+static CURLcode _NWG_curl_easy_set_post_field_size(CURL * _Nonnull curl, CCURLOffset size) {
+  return curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, size);
+}
+
 static CURLcode _NWG_curl_easy_set_read_user_info(CURL * _Nonnull curl, void * _Nullable userInfo) {
   return curl_easy_setopt(curl, CURLOPT_READDATA, userInfo);
 }
@@ -129,6 +129,29 @@ public actor EasyClient {
     try _throwIfFailed({ _NWG_curl_easy_set_http_method_to_put($0) })
   }
 
+  public enum HTTPVersion: Sendable {
+    case http1_0
+    case http1_1
+    case http2
+
+    fileprivate var _curlHTTPVersion: NWGCURLHTTPVersion {
+      switch self {
+      case .http1_0:
+        return NWGCURLHTTPVersion1_0
+      case .http1_1:
+        return NWGCURLHTTPVersion1_1
+      case .http2:
+        return NWGCURLHTTPVersion2
+      }
+    }
+  }
+
+  /// Specifies HTTP version to be used.
+  /// Note that it is just a preference for `.http2`; libcurl may fall back to HTTP/1.1.
+  public func setHTTPVersion(_ version: HTTPVersion) throws {
+    try _throwIfFailed({ _NWG_curl_easy_set_http_version($0, version._curlHTTPVersion) })
+  }
+
   private var _maxNumberOfRedirectsAllowed: Int = 0
 
   /// - parameters:
@@ -160,6 +183,13 @@ public actor EasyClient {
     try _throwIfFailed({ _NWG_curl_easy_set_upload_file_size($0, size) })
   }
 
+  /// Tells libcurl the size of the request body sent by POST,
+  /// so that "Content-Length" is sent instead of chunked transfer encoding.
+  public func setPostFieldSize(_ size: CCURLOffset) throws {
+    _requestBodySize = Int(size)
+    try _throwIfFailed({ _NWG_curl_easy_set_post_field_size($0, size) })
+  }
+
   public func setURL(_ url: URL) throws {
     try _throwIfFailed({ _NWG_curl_easy_set_url($0, url.absoluteString) })
   }
@@ -19,6 +19,10 @@ public protocol CURLClientDelegate: Sendable, AnyObject {
 
   var requestHeaderFields: Array<CURLHeaderField>? { get }
 
+  /// Request header fields prepared in advance.
+  /// `requestHeaderFields` are sent in addition to (or instead of, if their names are the same) them.
+  var preparedRequestHeaderFields: CURLPreparedHeaderFieldList? { get }
+
   var hasRequestBody: Bool { get }
 
   /// Sends a part of request body.
@@ -29,6 +33,16 @@ public protocol CURLClientDelegate: Sendable, AnyObject {
   ///            by the pointer `buffer`.
   func readNextPartialRequestBody(_ buffer: UnsafeMutablePointer<CChar>, maxLength: CSize) -> CSize
 
+  /// Whether or not the request body can be rewound by `rewindRequestBody(toOffset:)`.
+  ///
+  /// If `false`, the request body is cached by the client to be re-sent when redirected.
+  var isRequestBodyRewindable: Bool { get }
+
+  /// Moves the position from which the next part of request body will be read.
+  ///
+  /// - Returns: `false` if the request body can't be rewound.
+  func rewindRequestBody(toOffset offset: UInt64) -> Bool
+
   func setResponseCode(_ responseCode: CURLResponseCode)
 
   func appendResponseHeaderField(_ responseHeaderField: CURLHeaderField)
@@ -39,6 +53,20 @@ public protocol CURLClientDelegate: Sendable, AnyObject {
   func writeNextPartialResponseBody(_ bodyPart: UnsafeMutablePointer<CChar>, length: CSize) -> CSize
 }
 
+extension CURLClientDelegate {
+  public var preparedRequestHeaderFields: CURLPreparedHeaderFieldList? {
+    return nil
+  }
+
+  public var isRequestBodyRewindable: Bool {
+    return false
+  }
+
+  public func rewindRequestBody(toOffset offset: UInt64) -> Bool {
+    return false
+  }
+}
+
 public protocol CURLRequestBodySender {
   /// Sends a part of request body.
   /// The data area pointed at by `buffer` should be filled up with
@@ -49,6 +77,17 @@ public protocol CURLRequestBodySender {
   mutating func readNextPartialRequestBody(_ buffer: UnsafeMutablePointer<CChar>, maxLength: CSize) -> CSize
 }
 
+/// A `CURLRequestBodySender` that can send its content again from any position.
+///
+/// The client doesn't need to cache the request body sent by such a sender
+/// even when it is redirected.
+public protocol CURLRewindableRequestBodySender: CURLRequestBodySender {
+  /// Moves the position from which the next part of request body will be read.
+  ///
+  /// - Returns: `false` if `offset` is out of range.
+  mutating func rewindRequestBody(toOffset offset: UInt64) -> Bool
+}
+
 public protocol CURLResponseBodyReceiver {
   /// Receives a part of response body.
   ///
@@ -64,6 +103,14 @@ open class CURLClientGeneralDelegate: CURLClientDelegate, @unchecked Sendable {
       func readNextPartialRequestBody(_ buffer: UnsafeMutablePointer<CChar>, maxLength: CSize) -> CSize {
         return -1
       }
+
+      var isRewindable: Bool {
+        return false
+      }
+
+      func rewindRequestBody(toOffset offset: UInt64) -> Bool {
+        return false
+      }
     }
 
     private class _SomeRequestBodySender<T>: _RequestBodyBase, @unchecked Sendable where T: CURLRequestBodySender {
@@ -76,6 +123,17 @@ open class CURLClientGeneralDelegate: CURLClientDelegate, @unchecked Sendable {
       }
     }
 
+    private final class _SomeRewindableRequestBodySender<T>: _SomeRequestBodySender<T>,
+                                                             @unchecked Sendable where T: CURLRewindableRequestBodySender {
+      override var isRewindable: Bool {
+        return true
+      }
+
+      override func rewindRequestBody(toOffset offset: UInt64) -> Bool {
+        return _base.rewindRequestBody(toOffset: offset)
+      }
+    }
+
     private final class _InputStream: _RequestBodyBase, @unchecked Sendable {
       private let stream: InputStream
       init(_ stream: InputStream) {
@@ -197,10 +255,22 @@ open class CURLClientGeneralDelegate: CURLClientDelegate, @unchecked Sendable {
       return _base.readNextPartialRequestBody(buffer, maxLength: maxLength)
     }
 
+    fileprivate var isRewindable: Bool {
+      return _base.isRewindable
+    }
+
+    fileprivate mutating func rewindRequestBody(toOffset offset: UInt64) -> Bool {
+      return _base.rewindRequestBody(toOffset: offset)
+    }
+
     public init<T>(_ sender: T) where T: CURLRequestBodySender {
       self._base = _SomeRequestBodySender<T>(sender)
     }
 
+    public init<T>(_ sender: T) where T: CURLRewindableRequestBodySender {
+      self._base = _SomeRewindableRequestBodySender<T>(sender)
+    }
+
     public init(stream: InputStream) {
       self._base = _InputStream(stream)
     }
@@ -347,6 +417,8 @@ open class CURLClientGeneralDelegate: CURLClientDelegate, @unchecked Sendable {
 
   open var requestHeaderFields: Array<CURLHeaderField>?
 
+  open var preparedRequestHeaderFields: CURLPreparedHeaderFieldList?
+
   private var _requestBody: RequestBody?
 
   open var hasRequestBody: Bool {
@@ -358,6 +430,15 @@ open class CURLClientGeneralDelegate: CURLClientDelegate, @unchecked Sendable {
     return _requestBody?.readNextPartialRequestBody(buffer, maxLength: maxLength) ?? -1
   }
 
+  open var isRequestBodyRewindable: Bool {
+    return _requestBody?.isRewindable ?? false
+  }
+
+  open func rewindRequestBody(toOffset offset: UInt64) -> Bool {
+    assert(isPerforming)
+    return _requestBody?.rewindRequestBody(toOffset: offset) ?? false
+  }
+
   open private(set) var responseCode: CURLResponseCode!
 
   open func setResponseCode(_ responseCode: CURLResponseCode) {
@@ -385,11 +466,13 @@ open class CURLClientGeneralDelegate: CURLClientDelegate, @unchecked Sendable {
 
   public init(
     requestHeaderFields: Array<CURLHeaderField>? = nil,
+    preparedRequestHeaderFields: CURLPreparedHeaderFieldList? = nil,
     requestBody: RequestBody? = nil,
     responseBody: ResponseBody = .init()
   ) {
     self.__state = .init(isPerforming: false, didFinish: false)
     self.requestHeaderFields = requestHeaderFields
+    self.preparedRequestHeaderFields = preparedRequestHeaderFields
     self._requestBody = requestBody
     self._responseBody = responseBody
   }
@@ -136,6 +136,10 @@ internal final class _UserInfo {
       fatalError("Must be overridden.")
     }
 
+    var preparedRequestHeaderFields: CURLPreparedHeaderFieldList? {
+      fatalError("Must be overridden.")
+    }
+
     var hasRequestBody: Bool {
       fatalError("Must be overridden.")
     }
@@ -144,6 +148,14 @@ internal final class _UserInfo {
       fatalError("Must be overridden.")
     }
 
+    var isRequestBodyRewindable: Bool {
+      fatalError("Must be overridden.")
+    }
+
+    func rewindRequestBody(toOffset offset: UInt64) -> Bool {
+      fatalError("Must be overridden.")
+    }
+
     func setResponseCode(_ responseCode: CURLResponseCode) {
       fatalError("Must be overridden.")
     }
@@ -175,6 +187,10 @@ internal final class _UserInfo {
       return _pointer.pointee.requestHeaderFields
     }
 
+    override var preparedRequestHeaderFields: CURLPreparedHeaderFieldList? {
+      return _pointer.pointee.preparedRequestHeaderFields
+    }
+
     override var hasRequestBody: Bool {
       return _pointer.pointee.hasRequestBody
     }
@@ -183,6 +199,14 @@ internal final class _UserInfo {
       return _pointer.pointee.readNextPartialRequestBody(buffer, maxLength: maxLength)
     }
 
+    override var isRequestBodyRewindable: Bool {
+      return _pointer.pointee.isRequestBodyRewindable
+    }
+
+    override func rewindRequestBody(toOffset offset: UInt64) -> Bool {
+      return _pointer.pointee.rewindRequestBody(toOffset: offset)
+    }
+
     override func setResponseCode(_ responseCode: CURLResponseCode) {
       _pointer.pointee.setResponseCode(responseCode)
     }
@@ -207,6 +231,9 @@ internal final class _UserInfo {
 
   private let _requestBodySize: Int?
 
+  /// If `true`, the delegate rewinds the request body by itself instead of `_requestBodyCache`.
+  private let _requestBodyIsRewindable: Bool
+
   private let _requestBodyCache: _RequestBodyCache?
 
   private let _maxNumberOfRedirectsAllowed: Int
@@ -232,27 +259,54 @@ internal final class _UserInfo {
 
   private var _lastResponseHeaderField: CURLHeaderField? = nil
 
+  private var _requestHeaderFieldListIsGenerated: Bool = false
+
+  /// The list of per-request fields owned by this instance.
   private var _requestHeaderFieldList: UnsafeMutablePointer<CCURLStringList>? = nil
+
+  /// Retained while `_requestHeaderFieldList` or `_preparedRequestHeaderFieldNodes` may refer to its list.
+  private var _preparedRequestHeaderFields: CURLPreparedHeaderFieldList? = nil
+
+  /// The last node of `_requestHeaderFieldList` whose `next` is linked to the prepared list.
+  private var _requestHeaderFieldListLinkingNode: UnsafeMutablePointer<CCURLStringList>? = nil
+
+  /// Nodes referring to the strings of the prepared list except overridden ones,
+  /// followed by `_requestHeaderFieldList`.
+  private var _preparedRequestHeaderFieldNodes: UnsafeMutableBufferPointer<CCURLStringList>? = nil
+
   var requestHeaderFieldList: UnsafePointer<CCURLStringList>? {
     get throws {
-      if _requestHeaderFieldList == nil {
-        guard let fields = _delegatePointer.requestHeaderFields,
-              let firstField = fields.first else {
-          return nil
-        }
-        guard var currentList = _NWG_curl_slist_create("\(firstField.name): \(firstField.value)") else {
-          throw Error.failedToGenerateRequestHeaders
-        }
-        for field in fields.dropFirst() {
-          guard let newList = _NWG_curl_slist_append(currentList, "\(field.name): \(field.value)") else {
-            _NWG_curl_slist_free_all(currentList)
-            throw Error.failedToGenerateRequestHeaders
+      if !_requestHeaderFieldListIsGenerated {
+        let fields = _delegatePointer.requestHeaderFields ?? []
+        _requestHeaderFieldList = try _makeCURLStringList(fields)
+        if let prepared = _delegatePointer.preparedRequestHeaderFields {
+          _preparedRequestHeaderFields = prepared
+          if prepared._isOverridden(by: fields) {
+            // Skip the overridden fields with our own nodes sharing the strings of the prepared list.
+            if let nodes = prepared._nodes(notOverriddenBy: fields) {
+              nodes[nodes.count - 1].next = _requestHeaderFieldList
+              _preparedRequestHeaderFieldNodes = nodes
+            }
+          } else if let list = _requestHeaderFieldList {
+            // Layer the fields on top of the prepared list without copying it.
+            var lastNode = list
+            while let next = lastNode.pointee.next {
+              lastNode = next
+            }
+            lastNode.pointee.next = prepared._list
+            _requestHeaderFieldListLinkingNode = lastNode
           }
-          currentList = newList
         }
-        _requestHeaderFieldList = currentList
+        _requestHeaderFieldListIsGenerated = true
       }
-      return UnsafePointer<CCURLStringList>(_requestHeaderFieldList)
+      guard let list = (
+        _preparedRequestHeaderFieldNodes?.baseAddress ??
+        _requestHeaderFieldList ??
+        _preparedRequestHeaderFields?._list
+      ) else {
+        return nil
+      }
+      return UnsafePointer<CCURLStringList>(list)
     }
   }
 
@@ -262,15 +316,19 @@ internal final class _UserInfo {
   }
 
   deinit {
+    // Unlink the prepared list not to free it.
+    _requestHeaderFieldListLinkingNode?.pointee.next = nil
     _NWG_curl_slist_free_all(_requestHeaderFieldList)
+    // The strings are owned by the prepared list.
+    _preparedRequestHeaderFieldNodes?.deallocate()
   }
 
   func readNextPartialRequestBody(_ buffer: UnsafeMutablePointer<CChar>, maxLength: CSize) -> CSize {
     assert(hasRequestBody, "Unexpected call in spite of missing request body?!")
     do {
-      if _responseCount == 0 {
+      if _responseCount == 0 || _requestBodyIsRewindable {
         let actualLength = _delegatePointer.readNextPartialRequestBody(buffer, maxLength: maxLength)
-        if _maxNumberOfRedirectsAllowed == 0 {
+        if _maxNumberOfRedirectsAllowed == 0 || _requestBodyIsRewindable {
           return actualLength
         }
         guard let requestBodyCache = _requestBodyCache else {
@@ -301,6 +359,12 @@ internal final class _UserInfo {
   ///    `false` indicates `CURL_SEEKFUNC_CANTSEEK`, or
   ///    throwing an error indicates `CURL_SEEKFUNC_FAIL`.
   func rewindRequestBody(toOffset offset: UInt64, from origin: NWGCURLSeekOrigin) throws -> Bool {
+    if _requestBodyIsRewindable {
+      guard origin == NWGCURLSeekOriginStart else {
+        return false
+      }
+      return _delegatePointer.rewindRequestBody(toOffset: offset)
+    }
     guard _responseCount > 0 else {
       return false
     }
@@ -413,8 +477,13 @@ internal final class _UserInfo {
   ) throws where Delegate: CURLClientDelegate {
     self._delegatePointer = _DelegatePointer<Delegate>(delegatePointer)
     self._requestBodySize = requestBodySize
+    self._requestBodyIsRewindable = (
+      delegatePointer.pointee.hasRequestBody && delegatePointer.pointee.isRequestBodyRewindable
+    )
     self._requestBodyCache = (
-      delegatePointer.pointee.hasRequestBody && maxNumberOfRedirectsAllowed != 0
+      delegatePointer.pointee.hasRequestBody &&
+      !delegatePointer.pointee.isRequestBodyRewindable &&
+      maxNumberOfRedirectsAllowed != 0
     ) ? try _RequestBodyCache(requestBodySize: requestBodySize) : nil
     self._maxNumberOfRedirectsAllowed = maxNumberOfRedirectsAllowed
   }
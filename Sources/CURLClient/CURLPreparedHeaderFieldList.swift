@@ -0,0 +1,104 @@
+/* *************************************************************************************************
+ CURLPreparedHeaderFieldList.swift
+   © 2025 YOCKOW.
+     Licensed under MIT License.
+     See "LICENSE.txt" for more information.
+ **************************************************************************************************/
+
+import CLibCURL
+import Foundation
+
+/// Creates a new `curl_slist` whose strings are "`name`: `value`".
+///
+/// - Returns: `nil` if `fields` is empty.
+internal func _makeCURLStringList<S>(
+  _ fields: S
+) throws -> UnsafeMutablePointer<CCURLStringList>? where S: Sequence, S.Element == CURLHeaderField {
+  var list: UnsafeMutablePointer<CCURLStringList>? = nil
+  for field in fields {
+    let line = "\(field.name): \(field.value)"
+    let maybeNewList = if let list {
+      _NWG_curl_slist_append(list, line)
+    } else {
+      _NWG_curl_slist_create(line)
+    }
+    guard let newList = maybeNewList else {
+      _NWG_curl_slist_free_all(list)
+      throw _UserInfo.Error.failedToGenerateRequestHeaders
+    }
+    list = newList
+  }
+  return list
+}
+
+/// An immutable list of request header fields that is serialized into libcurl's string list only once.
+///
+/// An instance can be shared among many requests (even if they are performed concurrently)
+/// because libcurl never modifies the list during the transfer.
+/// Per-request fields given by `CURLClientDelegate.requestHeaderFields` are layered on top of the list
+/// without copying any string in it, even if some of them override the fields in the list.
+public final class CURLPreparedHeaderFieldList: @unchecked Sendable {
+  public enum Error: Swift.Error {
+    case failedToPrepareHeaderFields
+  }
+
+  /// The fields contained in the list.
+  public let fields: Array<CURLHeaderField>
+
+  private let _lowercasedNames: Array<String>
+
+  private let _lowercasedNameSet: Set<String>
+
+  internal let _list: UnsafeMutablePointer<CCURLStringList>?
+
+  public init(_ fields: Array<CURLHeaderField>) throws {
+    self.fields = fields
+    self._lowercasedNames = fields.map({ $0.name.lowercased() })
+    self._lowercasedNameSet = Set(_lowercasedNames)
+    do {
+      self._list = try _makeCURLStringList(fields)
+    } catch {
+      throw Error.failedToPrepareHeaderFields
+    }
+  }
+
+  deinit {
+    _NWG_curl_slist_free_all(_list)
+  }
+
+  /// Returns `true` if any field in `overridingFields` has the same name with the field in the list.
+  internal func _isOverridden<S>(by overridingFields: S) -> Bool where S: Sequence, S.Element == CURLHeaderField {
+    return overridingFields.contains(where: { _lowercasedNameSet.contains($0.name.lowercased()) })
+  }
+
+  /// Returns newly allocated nodes chained in order that refer to the strings in the list
+  /// except ones whose names are the same with any field in `overridingFields`.
+  ///
+  /// - Returns: `nil` if all the fields are overridden.
+  /// - Note: The caller must deallocate the nodes, but must not free their strings
+  ///         that are still owned by the list.
+  internal func _nodes(
+    notOverriddenBy overridingFields: Array<CURLHeaderField>
+  ) -> UnsafeMutableBufferPointer<CCURLStringList>? {
+    let overridingNames = Set(overridingFields.map({ $0.name.lowercased() }))
+    var strings: Array<UnsafeMutablePointer<CChar>?> = []
+    var node = _list
+    for name in _lowercasedNames {
+      guard let currentNode = node else { fatalError("The list is shorter than the fields?!") }
+      if !overridingNames.contains(name) {
+        strings.append(currentNode.pointee.data)
+      }
+      node = currentNode.pointee.next
+    }
+    if strings.isEmpty {
+      return nil
+    }
+
+    let nodes = UnsafeMutableBufferPointer<CCURLStringList>.allocate(capacity: strings.count)
+    for (ii, string) in strings.enumerated() {
+      let next = ii + 1 < nodes.count ? nodes.baseAddress! + (ii + 1) : nil
+      (nodes.baseAddress! + ii).initialize(to: CCURLStringList(data: string, next: next))
+    }
+    return nodes
+  }
+}
@@ -0,0 +1,97 @@
+/* *************************************************************************************************
+ MIMEType+Interning.swift
+   © 2025 YOCKOW.
+     Licensed under MIT License.
+     See "LICENSE.txt" for more information.
+ ************************************************************************************************ */
+
+/// Hash function for the perfect hash tables in "MIMEType+PathExtension.swift".
+///
+/// - Important: It must be identical to the one used by `utils/SwiftNetworkGearUpdater`
+///              that generates the tables.
+internal struct _MIMETypePerfectHasher {
+  // FNV-1a (ASCII case-insensitive)
+  private var _value: UInt64 = 0xCBF29CE484222325
+
+  internal init() {}
+
+  internal mutating func combine(_ byte: UInt8) {
+    let folded = (0x41...0x5A).contains(byte) ? byte | 0x20 : byte
+    _value = (_value ^ UInt64(folded)) &* 0x100000001B3
+  }
+
+  internal mutating func combine<S>(_ bytes: S) where S: Sequence, S.Element == UInt8 {
+    for byte in bytes {
+      combine(byte)
+    }
+  }
+
+  /// Returns the index of the slot where the key may be stored.
+  internal func slot(displacements: [UInt32], numberOfSlots: Int) -> Int {
+    let bucket = Int((_value >> 32) % UInt64(displacements.count))
+    // MurmurHash3's finalizer
+    var mixed = UInt32(truncatingIfNeeded: _value) ^ displacements[bucket]
+    mixed ^= mixed >> 16
+    mixed &*= 0x85EBCA6B
+    mixed ^= mixed >> 13
+    mixed &*= 0xC2B2AE35
+    mixed ^= mixed >> 16
+    return Int(mixed % UInt32(numberOfSlots))
+  }
+}
+
+extension MIMEType.PathExtension {
+  /// Looks up the path extension represented by `bytes` without any comparison of strings other
+  /// than the final check.
+  internal static func _lookUp<C>(_ bytes: C, caseSensitive: Bool) -> MIMEType.PathExtension? where C: Collection, C.Element == UInt8 {
+    var hasher = _MIMETypePerfectHasher()
+    hasher.combine(bytes)
+    let candidate = _pathExtensionHashSlots[
+      hasher.slot(displacements: _pathExtensionHashDisplacements, numberOfSlots: _pathExtensionHashSlots.count)
+    ]
+    let matches = caseSensitive
+      ? candidate.rawValue.utf8.elementsEqual(bytes)
+      : candidate.rawValue.utf8.elementsEqual(bytes, by: { $0 == ((0x41...0x5A).contains($1) ? $1 | 0x20 : $1) })
+    return matches ? candidate : nil
+  }
+
+  /// Initializes with `string` ignoring its case, e.g. "HTML" is recognized as `.html`.
+  public init?<S>(caseInsensitiveString string: S) where S: StringProtocol {
+    guard let pathExtension = MIMEType.PathExtension._lookUp(string.utf8, caseSensitive: false) else {
+      return nil
+    }
+    self = pathExtension
+  }
+}
+
+extension MIMEType._Core {
+  /// The ID of the interned MIME type that is equal to the instance, if any.
+  internal var _internedID: UInt16? {
+    var hasher = _MIMETypePerfectHasher()
+    hasher.combine(_type.rawValue.utf8)
+    hasher.combine(0x2F) // "/"
+    if let tree = _tree {
+      hasher.combine(tree.rawValue.utf8)
+      hasher.combine(0x2E) // "."
+    }
+    hasher.combine(_subtype.utf8)
+    if let suffix = _suffix {
+      hasher.combine(0x2B) // "+"
+      hasher.combine(suffix.rawValue.utf8)
+    }
+    let id = _internedMIMETypeHashSlots[
+      hasher.slot(displacements: _internedMIMETypeHashDisplacements, numberOfSlots: _internedMIMETypeHashSlots.count)
+    ]
+    return _internedMIMETypeCores[Int(id)] == self ? id : nil
+  }
+}
+
+/// Returns the ID of the interned MIME type whose description is exactly `bytes`.
+internal func _internedMIMETypeID<C>(of bytes: C) -> UInt16? where C: Collection, C.Element == UInt8 {
+  var hasher = _MIMETypePerfectHasher()
+  hasher.combine(bytes)
+  let id = _internedMIMETypeHashSlots[
+    hasher.slot(displacements: _internedMIMETypeHashDisplacements, numberOfSlots: _internedMIMETypeHashSlots.count)
+  ]
+  return _internedMIMETypeStrings[Int(id)].utf8.elementsEqual(bytes) ? id : nil
+}
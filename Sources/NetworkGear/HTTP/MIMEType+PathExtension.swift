@@ -8,7 +8,7 @@
 // ETag: "1920589//httpd/httpd/trunk/docs/conf/mime.types"
 
 extension MIMEType {
-  public enum PathExtension: String, Sendable {
+  public enum PathExtension: String, CaseIterable, Sendable {
      case _123 = "123"
      case _3dml = "3dml"
      case _3ds = "3ds"
@@ -1000,1771 +1000,4437 @@ extension MIMEType {
      case zir = "zir"
      case zirz = "zirz"
      case zmm = "zmm"
+
+    public init?(rawValue: String) {
+      guard let pathExtension = PathExtension._lookUp(rawValue.utf8, caseSensitive: true) else {
+        return nil
+      }
+      self = pathExtension
+    }
+  }
+}
+
+extension MIMEType.PathExtension {
+  internal var _internedMIMETypeID: UInt16 {
+    switch self {
+    case ._123: return 392
+    case ._3dml: return 725
+    case ._3ds: return 643
+    case ._3g2: return 731
+    case ._3gp: return 730
+    case ._7z: return 112
+    case .aab: return 116
+    case .aac: return 595
+    case .aam: return 117
+    case .aas: return 118
+    case .abw: return 113
+    case .ac: return 66
+    case .acc: return 246
+    case .ace: return 114
+    case .acu: return 235
+    case .acutc: return 236
+    case .adp: return 586
+    case .aep: return 256
+    case .afm: return 147
+    case .afp: return 355
+    case .ahead: return 242
+    case .ai: return 72
+    case .aif: return 596
+    case .aifc: return 596
+    case .aiff: return 596
+    case .air: return 237
+    case .ait: return 293
+    case .ami: return 247
+    case .apk: return 248
+    case .appcache: return 689
+    case .application: return 163
+    case .apr: return 393
+    case .arc: return 148
+    case .asc: return 60
+    case .asf: return 750
+    case .asm: return 704
+    case .aso: return 233
+    case .asx: return 750
+    case .atc: return 236
+    case .atom: return 2
+    case .atomcat: return 3
+    case .atomsvc: return 4
+    case .atx: return 251
+    case .au: return 587
+    case .avi: return 756
+    case .avif: return 629
+    case .aw: return 1
+    case .azf: return 243
+    case .azs: return 244
+    case .azw: return 245
+    case .bat: return 172
+    case .bcpio: return 119
+    case .bdf: return 142
+    case .bdm: return 549
+    case .bed: return 504
+    case .bh2: return 319
+    case .bin: return 50
+    case .blb: return 121
+    case .blorb: return 121
+    case .bmi: return 258
+    case .bmp: return 630
+    case .book: return 311
+    case .box: return 499
+    case .boz: return 123
+    case .bpk: return 50
+    case .btif: return 660
+    case .bz: return 122
+    case .bz2: return 123
+    case .c: return 705
+    case .c11amc: return 266
+    case .c11amz: return 267
+    case .c4d: return 265
+    case .c4f: return 265
+    case .c4g: return 265
+    case .c4p: return 265
+    case .c4u: return 265
+    case .cab: return 419
+    case .caf: return 597
+    case .cap: return 552
+    case .car: return 279
+    case .cat: return 430
+    case .cb7: return 124
+    case .cba: return 124
+    case .cbr: return 124
+    case .cbt: return 124
+    case .cbz: return 124
+    case .cc: return 705
+    case .cct: return 134
+    case .ccxml: return 5
+    case .cdbcmsg: return 269
+    case .cdf: return 180
+    case .cdkey: return 402
+    case .cdmia: return 6
+    case .cdmic: return 7
+    case .cdmid: return 8
+    case .cdmio: return 9
+    case .cdmiq: return 10
+    case .cdx: return 618
+    case .cdxml: return 260
+    case .cdy: return 262
+    case .cer: return 67
+    case .cfs: return 126
+    case .cgm: return 631
+    case .chat: return 127
+    case .chm: return 426
+    case .chrt: return 377
+    case .cif: return 619
+    case .cii: return 249
+    case .cil: return 418
+    case .cla: return 263
+    case .`class`: return 29
+    case .clkk: return 272
+    case .clkp: return 273
+    case .clkt: return 274
+    case .clkw: return 275
+    case .clkx: return 271
+    case .clp: return 171
+    case .cmc: return 270
+    case .cmdf: return 620
+    case .cml: return 621
+    case .cmp: return 583
+    case .cmx: return 645
+    case .cod: return 508
+    case .com: return 172
+    case .conf: return 696
+    case .cpio: return 130
+    case .cpp: return 705
+    case .cpt: return 34
+    case .crd: return 170
+    case .crl: return 68
+    case .crt: return 207
+    case .cryptonote: return 507
+    case .csh: return 131
+    case .csml: return 622
+    case .csp: return 268
+    case .css: return 691
+    case .cst: return 134
+    case .csv: return 692
+    case .cu: return 11
+    case .curl: return 717
+    case .cww: return 227
+    case .cxt: return 134
+    case .cxx: return 705
+    case .dae: return 684
+    case .daf: return 408
+    case .dart: return 281
+    case .dataless: return 308
+    case .davmount: return 12
+    case .dbk: return 13
+    case .dcr: return 134
+    case .dcurl: return 718
+    case .dd2: return 478
+    case .ddd: return 320
+    case .deb: return 132
+    case .def: return 696
+    case .deploy: return 50
+    case .der: return 207
+    case .dfac: return 291
+    case .dgc: return 133
+    case .dic: return 705
+    case .dir: return 134
+    case .dis: return 409
+    case .dist: return 50
+    case .distz: return 50
+    case .djv: return 663
+    case .djvu: return 663
+    case .dll: return 172
+    case .dmg: return 115
+    case .dmp: return 552
+    case .dms: return 50
+    case .dna: return 288
+    case .doc: return 48
+    case .docm: return 439
+    case .docx: return 486
+    case .dot: return 48
+    case .dotm: return 440
+    case .dotx: return 487
+    case .dp: return 489
+    case .dpg: return 290
+    case .dra: return 609
+    case .dsc: return 716
+    case .dssc: return 14
+    case .dtb: return 137
+    case .dtd: return 218
+    case .dts: return 610
+    case .dtshd: return 611
+    case .dump: return 50
+    case .dvb: return 764
+    case .dvi: return 139
+    case .dwf: return 685
+    case .dwg: return 665
+    case .dxf: return 666
+    case .dxp: return 525
+    case .dxr: return 134
+    case .ecelp4800: return 614
+    case .ecelp7470: return 615
+    case .ecelp9600: return 616
+    case .ecma: return 16
+    case .edm: return 457
+    case .edx: return 458
+    case .efif: return 495
+    case .ei6: return 494
+    case .elc: return 50
+    case .emf: return 174
+    case .eml: return 677
+    case .emma: return 17
+    case .emz: return 174
+    case .eol: return 608
+    case .eot: return 425
+    case .eps: return 72
+    case .epub: return 18
+    case .es3: return 303
+    case .esa: return 490
+    case .esf: return 298
+    case .et3: return 303
+    case .etx: return 711
+    case .eva: return 141
+    case .evy: return 140
+    case .exe: return 172
+    case .exi: return 19
+    case .ext: return 459
+    case .ez: return 0
+    case .ez2: return 304
+    case .ez3: return 305
+    case .f: return 706
+    case .f4v: return 744
+    case .f77: return 706
+    case .f90: return 706
+    case .fbs: return 667
+    case .fcdt: return 238
+    case .fcs: return 370
+    case .fdf: return 306
+    case .feLaunch: return 287
+    case .fg5: return 318
+    case .fgd: return 134
+    case .fh: return 646
+    case .fh4: return 646
+    case .fh5: return 646
+    case .fh7: return 646
+    case .fhc: return 646
+    case .fig: return 208
+    case .flac: return 598
+    case .fli: return 745
+    case .flo: return 405
+    case .flv: return 746
+    case .flw: return 379
+    case .flx: return 723
+    case .fly: return 722
+    case .fm: return 311
+    case .fnc: return 312
+    case .`for`: return 706
+    case .fpx: return 668
+    case .frame: return 311
+    case .fsc: return 314
+    case .fst: return 669
+    case .ftc: return 310
+    case .fti: return 250
+    case .fvt: return 765
+    case .fxp: return 239
+    case .fxpl: return 239
+    case .fzs: return 323
+    case .g2w: return 330
+    case .g3: return 632
+    case .g3w: return 331
+    case .gac: return 336
+    case .gam: return 198
+    case .gbr: return 80
+    case .gca: return 150
+    case .gdl: return 686
+    case .geo: return 295
+    case .gex: return 328
+    case .ggb: return 325
+    case .ggs: return 326
+    case .ggt: return 327
+    case .ghf: return 337
+    case .gif: return 633
+    case .gim: return 338
+    case .gml: return 21
+    case .gmx: return 332
+    case .gnumeric: return 152
+    case .gph: return 309
+    case .gpx: return 22
+    case .gqf: return 335
+    case .gqs: return 335
+    case .gram: return 98
+    case .gramps: return 153
+    case .gre: return 328
+    case .grv: return 339
+    case .grxml: return 99
+    case .gsf: return 143
+    case .gtar: return 154
+    case .gtm: return 340
+    case .gtw: return 687
+    case .gv: return 724
+    case .gxf: return 23
+    case .gxt: return 329
+    case .h: return 705
+    case .h261: return 732
+    case .h263: return 733
+    case .h264: return 734
+    case .hal: return 343
+    case .hbci: return 345
+    case .hdf: return 155
+    case .hh: return 705
+    case .hlp: return 109
+    case .hpgl: return 347
+    case .hpid: return 348
+    case .hps: return 349
+    case .hqx: return 33
+    case .htke: return 384
+    case .htm: return 693
+    case .html: return 693
+    case .hvd: return 576
+    case .hvp: return 578
+    case .hvs: return 577
+    case .i2g: return 364
+    case .icc: return 358
+    case .icm: return 358
+    case .ico: return 647
+    case .ics: return 690
+    case .ief: return 634
+    case .ifb: return 690
+    case .ifm: return 517
+    case .iges: return 678
+    case .igl: return 359
+    case .igm: return 362
+    case .igs: return 678
+    case .igx: return 406
+    case .iif: return 519
+    case .imp: return 234
+    case .ims: return 427
+    case .`in`: return 696
+    case .ink: return 25
+    case .inkml: return 25
+    case .install: return 156
+    case .iota: return 255
+    case .ipfix: return 26
+    case .ipk: return 520
+    case .irm: return 356
+    case .irp: return 368
+    case .iso: return 157
+    case .itp: return 518
+    case .ivp: return 360
+    case .ivu: return 361
+    case .jad: return 727
+    case .jam: return 371
+    case .jar: return 27
+    case .java: return 707
+    case .jisp: return 373
+    case .jlt: return 350
+    case .jnlp: return 158
+    case .joda: return 374
+    case .jpe: return 635
+    case .jpeg: return 635
+    case .jpg: return 635
+    case .jpgm: return 736
+    case .jpgv: return 735
+    case .jpm: return 736
+    case .js: return 694
+    case .json: return 30
+    case .jsonml: return 31
+    case .jxl: return 636
+    case .kar: return 588
+    case .karbon: return 376
+    case .kfo: return 378
+    case .kia: return 385
+    case .kml: return 333
+    case .kmz: return 334
+    case .kne: return 386
+    case .knp: return 386
+    case .kon: return 380
+    case .kpr: return 381
+    case .kpt: return 381
+    case .kpxx: return 292
+    case .ksp: return 382
+    case .ktr: return 375
+    case .ktx: return 637
+    case .ktz: return 375
+    case .kwd: return 383
+    case .kwt: return 383
+    case .lasxml: return 389
+    case .latex: return 159
+    case .lbd: return 390
+    case .lbe: return 391
+    case .les: return 346
+    case .lha: return 160
+    case .link66: return 511
+    case .list: return 696
+    case .list3820: return 355
+    case .listafp: return 355
+    case .lnk: return 164
+    case .log: return 696
+    case .lostxml: return 32
+    case .lrf: return 50
+    case .lrm: return 428
+    case .ltf: return 313
+    case .lvp: return 612
+    case .lwp: return 398
+    case .lzh: return 160
+    case .m13: return 173
+    case .m14: return 173
+    case .m1v: return 740
+    case .m21: return 46
+    case .m2a: return 590
+    case .m2t: return 738
+    case .m2ts: return 738
+    case .m2v: return 740
+    case .m3a: return 590
+    case .m3u: return 600
+    case .m3u8: return 253
+    case .m4a: return 589
+    case .m4u: return 766
+    case .m4v: return 747
+    case .ma: return 38
+    case .mads: return 35
+    case .mag: return 296
+    case .maker: return 311
+    case .man: return 700
+    case .mar: return 50
+    case .mathml: return 39
+    case .mb: return 38
+    case .mbk: return 410
+    case .mbox: return 40
+    case .mc1: return 401
+    case .mcd: return 400
+    case .mcurl: return 719
+    case .mdb: return 168
+    case .mdi: return 672
+    case .me: return 700
+    case .mesh: return 679
+    case .meta4: return 43
+    case .metalink: return 42
+    case .mets: return 44
+    case .mfm: return 404
+    case .mft: return 81
+    case .mgp: return 488
+    case .mgz: return 500
+    case .mid: return 588
+    case .midi: return 588
+    case .mie: return 161
+    case .mif: return 407
+    case .mime: return 677
+    case .mj2: return 737
+    case .mjp2: return 737
+    case .mjs: return 694
+    case .mk3d: return 748
+    case .mka: return 599
+    case .mks: return 748
+    case .mkv: return 748
+    case .mlp: return 289
+    case .mmd: return 261
+    case .mmf: return 522
+    case .mmr: return 670
+    case .mng: return 749
+    case .mny: return 175
+    case .mobi: return 162
+    case .mods: return 45
+    case .mov: return 742
+    case .movie: return 757
+    case .mp2: return 590
+    case .mp21: return 46
+    case .mp2a: return 590
+    case .mp3: return 590
+    case .mp4: return 739
+    case .mp4a: return 589
+    case .mp4s: return 47
+    case .mp4v: return 739
+    case .mpc: return 416
+    case .mpe: return 740
+    case .mpeg: return 740
+    case .mpg: return 740
+    case .mpg4: return 739
+    case .mpga: return 590
+    case .mpkg: return 252
+    case .mpm: return 257
+    case .mpn: return 415
+    case .mpp: return 438
+    case .mpt: return 438
+    case .mpy: return 354
+    case .mqy: return 411
+    case .mrc: return 36
+    case .mrcx: return 37
+    case .ms: return 700
+    case .mscml: return 41
+    case .mseed: return 307
+    case .mseq: return 444
+    case .msf: return 299
+    case .msh: return 679
+    case .msi: return 172
+    case .msl: return 412
+    case .msty: return 446
+    case .mts: return 738
+    case .mus: return 445
+    case .musicxml: return 506
+    case .mvb: return 173
+    case .mwf: return 403
+    case .mxf: return 49
+    case .mxl: return 505
+    case .mxml: return 223
+    case .mxs: return 555
+    case .mxu: return 766
+    case .nGage: return 454
+    case .n3: return 695
+    case .nb: return 38
+    case .nbp: return 570
+    case .nc: return 180
+    case .ncx: return 136
+    case .nfo: return 708
+    case .ngdat: return 453
+    case .nitf: return 449
+    case .nlu: return 448
+    case .nml: return 297
+    case .nnd: return 450
+    case .nns: return 451
+    case .nnw: return 452
+    case .npx: return 674
+    case .nsc: return 129
+    case .nsf: return 395
+    case .ntf: return 449
+    case .nzb: return 181
+    case .oa2: return 316
+    case .oa3: return 317
+    case .oas: return 315
+    case .obd: return 169
+    case .obj: return 204
+    case .oda: return 51
+    case .odb: return 462
+    case .odc: return 460
+    case .odf: return 463
+    case .odft: return 464
+    case .odg: return 465
+    case .odi: return 467
+    case .odm: return 474
+    case .odp: return 469
+    case .ods: return 471
+    case .odt: return 473
+    case .oga: return 591
+    case .ogg: return 591
+    case .ogv: return 741
+    case .ogx: return 53
+    case .omdoc: return 54
+    case .onepkg: return 55
+    case .onetmp: return 55
+    case .onetoc: return 55
+    case .onetoc2: return 55
+    case .opf: return 52
+    case .opml: return 709
+    case .oprc: return 491
+    case .opus: return 591
+    case .org: return 396
+    case .osf: return 579
+    case .osfpvg: return 580
+    case .otc: return 461
+    case .otf: return 625
+    case .otg: return 466
+    case .oth: return 476
+    case .oti: return 468
+    case .otp: return 470
+    case .ots: return 472
+    case .ott: return 475
+    case .oxps: return 56
+    case .oxt: return 479
+    case .p: return 710
+    case .p10: return 62
+    case .p12: return 182
+    case .p7b: return 183
+    case .p7c: return 63
+    case .p7m: return 63
+    case .p7r: return 184
+    case .p7s: return 64
+    case .p8: return 65
+    case .pas: return 710
+    case .paw: return 492
+    case .pbd: return 498
+    case .pbm: return 652
+    case .pcap: return 552
+    case .pcf: return 145
+    case .pcl: return 351
+    case .pclxl: return 352
+    case .pct: return 650
+    case .pcurl: return 280
+    case .pcx: return 649
+    case .pdb: return 491
+    case .pdf: return 58
+    case .pfa: return 147
+    case .pfb: return 147
+    case .pfm: return 147
+    case .pfr: return 20
+    case .pfx: return 182
+    case .pgm: return 653
+    case .pgn: return 128
+    case .pgp: return 59
+    case .pic: return 650
+    case .pkg: return 50
+    case .pki: return 70
+    case .pkipath: return 69
+    case .plb: return 228
+    case .plc: return 413
+    case .plf: return 497
+    case .pls: return 71
+    case .pml: return 277
+    case .png: return 638
+    case .pnm: return 651
+    case .portpkg: return 399
+    case .pot: return 432
+    case .potm: return 437
+    case .potx: return 483
+    case .ppam: return 433
+    case .ppd: return 278
+    case .ppm: return 654
+    case .pps: return 432
+    case .ppsm: return 436
+    case .ppsx: return 482
+    case .ppt: return 432
+    case .pptm: return 434
+    case .pptx: return 480
+    case .pqa: return 491
+    case .prc: return 162
+    case .pre: return 394
+    case .prf: return 61
+    case .ps: return 72
+    case .psb: return 229
+    case .psd: return 661
+    case .psf: return 144
+    case .pskcxml: return 73
+    case .ptid: return 502
+    case .pub: return 176
+    case .pvb: return 230
+    case .pwn: return 232
+    case .pya: return 613
+    case .pyv: return 767
+    case .qam: return 300
+    case .qbo: return 365
+    case .qfx: return 366
+    case .qps: return 501
+    case .qt: return 742
+    case .qwd: return 503
+    case .qwt: return 503
+    case .qxb: return 503
+    case .qxd: return 503
+    case .qxl: return 503
+    case .qxt: return 503
+    case .ra: return 603
+    case .ram: return 603
+    case .rar: return 185
+    case .ras: return 644
+    case .rcprofile: return 367
+    case .rdf: return 74
+    case .rdz: return 282
+    case .rep: return 259
+    case .res: return 138
+    case .rgb: return 655
+    case .rif: return 75
+    case .rip: return 617
+    case .ris: return 186
+    case .rl: return 77
+    case .rlc: return 671
+    case .rld: return 78
+    case .rm: return 509
+    case .rmi: return 588
+    case .rmp: return 604
+    case .rms: return 372
+    case .rmvb: return 510
+    case .rnc: return 76
+    case .roa: return 82
+    case .roff: return 700
+    case .rp9: return 264
+    case .rpss: return 456
+    case .rpst: return 455
+    case .rq: return 96
+    case .rs: return 79
+    case .rsd: return 83
+    case .rss: return 84
+    case .rtf: return 85
+    case .rtx: return 697
+    case .s: return 704
+    case .s3m: return 592
+    case .saf: return 581
+    case .sbml: return 86
+    case .sc: return 357
+    case .scd: return 177
+    case .scm: return 397
+    case .scq: return 87
+    case .scs: return 88
+    case .scurl: return 720
+    case .sda: return 528
+    case .sdc: return 527
+    case .sdd: return 529
+    case .sdkd: return 524
+    case .sdkm: return 524
+    case .sdp: return 91
+    case .sdw: return 531
+    case .see: return 513
+    case .seed: return 308
+    case .sema: return 514
+    case .semd: return 515
+    case .semf: return 516
+    case .ser: return 28
+    case .setpay: return 92
+    case .setreg: return 93
+    case .sfdHdstx: return 353
+    case .sfs: return 526
+    case .sfv: return 712
+    case .sgi: return 639
+    case .sgl: return 532
+    case .sgm: return 698
+    case .sgml: return 698
+    case .sh: return 187
+    case .shar: return 188
+    case .shf: return 94
+    case .sid: return 648
+    case .sig: return 60
+    case .sil: return 593
+    case .silo: return 679
+    case .sis: return 547
+    case .sisx: return 547
+    case .sit: return 192
+    case .sitx: return 193
+    case .skd: return 387
+    case .skm: return 387
+    case .skp: return 387
+    case .skt: return 387
+    case .sldm: return 435
+    case .sldx: return 481
+    case .slt: return 301
+    case .sm: return 534
+    case .smf: return 530
+    case .smi: return 95
+    case .smil: return 95
+    case .smv: return 758
+    case .smzip: return 533
+    case .snd: return 587
+    case .snf: return 146
+    case .so: return 50
+    case .spc: return 183
+    case .spf: return 582
+    case .spl: return 149
+    case .spot: return 726
+    case .spp: return 90
+    case .spq: return 89
+    case .spx: return 591
+    case .sql: return 191
+    case .src: return 206
+    case .srt: return 194
+    case .sru: return 100
+    case .srx: return 97
+    case .ssdl: return 101
+    case .sse: return 388
+    case .ssf: return 302
+    case .ssml: return 102
+    case .st: return 512
+    case .stc: return 536
+    case .std: return 538
+    case .stf: return 573
+    case .sti: return 540
+    case .stk: return 24
+    case .stl: return 431
+    case .str: return 493
+    case .stw: return 544
+    case .sub: return 721
+    case .sus: return 545
+    case .susp: return 545
+    case .sv4cpio: return 195
+    case .sv4crc: return 196
+    case .svc: return 294
+    case .svd: return 546
+    case .svg: return 640
+    case .svgz: return 640
+    case .swa: return 134
+    case .swf: return 189
+    case .swi: return 254
+    case .sxc: return 535
+    case .sxd: return 537
+    case .sxg: return 543
+    case .sxi: return 539
+    case .sxm: return 541
+    case .sxw: return 542
+    case .t: return 700
+    case .t3: return 197
+    case .taglet: return 447
+    case .tao: return 551
+    case .tar: return 199
+    case .tcap: return 231
+    case .tcl: return 200
+    case .teacher: return 523
+    case .tei: return 103
+    case .teicorpus: return 103
+    case .tex: return 201
+    case .texi: return 203
+    case .texinfo: return 203
+    case .text: return 696
+    case .tfi: return 104
+    case .tfm: return 202
+    case .tga: return 656
+    case .thmx: return 429
+    case .tif: return 641
+    case .tiff: return 641
+    case .tmo: return 553
+    case .torrent: return 120
+    case .tpl: return 341
+    case .tpt: return 554
+    case .tr: return 700
+    case .tra: return 556
+    case .trm: return 178
+    case .ts: return 738
+    case .tsd: return 105
+    case .tsv: return 699
+    case .ttc: return 624
+    case .ttf: return 626
+    case .ttl: return 701
+    case .twd: return 521
+    case .twds: return 521
+    case .txd: return 324
+    case .txf: return 414
+    case .txt: return 696
+    case .u32: return 116
+    case .udeb: return 132
+    case .ufd: return 557
+    case .ufdl: return 557
+    case .ulx: return 151
+    case .umj: return 559
+    case .unityweb: return 560
+    case .uoml: return 561
+    case .uri: return 702
+    case .uris: return 702
+    case .urls: return 702
+    case .ustar: return 205
+    case .utz: return 558
+    case .uu: return 713
+    case .uva: return 607
+    case .uvd: return 283
+    case .uvf: return 283
+    case .uvg: return 662
+    case .uvh: return 759
+    case .uvi: return 662
+    case .uvm: return 760
+    case .uvp: return 761
+    case .uvs: return 762
+    case .uvt: return 284
+    case .uvu: return 768
+    case .uvv: return 763
+    case .uvva: return 607
+    case .uvvd: return 283
+    case .uvvf: return 283
+    case .uvvg: return 662
+    case .uvvh: return 759
+    case .uvvi: return 662
+    case .uvvm: return 760
+    case .uvvp: return 761
+    case .uvvs: return 762
+    case .uvvt: return 284
+    case .uvvu: return 768
+    case .uvvv: return 763
+    case .uvvx: return 285
+    case .uvvz: return 286
+    case .uvx: return 285
+    case .uvz: return 286
+    case .vcard: return 703
+    case .vcd: return 125
+    case .vcf: return 715
+    case .vcg: return 342
+    case .vcs: return 714
+    case .vcx: return 562
+    case .vis: return 564
+    case .viv: return 769
+    case .vob: return 751
+    case .vor: return 531
+    case .vox: return 116
+    case .vrml: return 680
+    case .vsd: return 563
+    case .vsf: return 565
+    case .vss: return 563
+    case .vst: return 563
+    case .vsw: return 563
+    case .vtu: return 688
+    case .vxml: return 106
+    case .w3d: return 134
+    case .wad: return 135
+    case .wasm: return 107
+    case .wav: return 605
+    case .wax: return 601
+    case .wbmp: return 675
+    case .wbs: return 276
+    case .wbxml: return 566
+    case .wcm: return 441
+    case .wdb: return 441
+    case .wdp: return 673
+    case .weba: return 594
+    case .webm: return 743
+    case .webp: return 642
+    case .wg: return 496
+    case .wgt: return 108
+    case .wks: return 441
+    case .wm: return 752
+    case .wma: return 602
+    case .wmd: return 165
+    case .wmf: return 174
+    case .wml: return 728
+    case .wmlc: return 567
+    case .wmls: return 729
+    case .wmlsc: return 568
+    case .wmv: return 753
+    case .wmx: return 754
+    case .wmz: return 174
+    case .woff: return 627
+    case .woff2: return 628
+    case .wpd: return 571
+    case .wpl: return 442
+    case .wps: return 441
+    case .wqd: return 572
+    case .wri: return 179
+    case .wrl: return 680
+    case .wsdl: return 110
+    case .wspolicy: return 111
+    case .wtb: return 569
+    case .wvx: return 755
+    case .x32: return 116
+    case .x3d: return 681
+    case .x3db: return 682
+    case .x3dbz: return 682
+    case .x3dv: return 683
+    case .x3dvz: return 683
+    case .x3dz: return 681
+    case .xaml: return 213
+    case .xap: return 190
+    case .xar: return 574
+    case .xbap: return 167
+    case .xbd: return 322
+    case .xbm: return 657
+    case .xdf: return 214
+    case .xdm: return 550
+    case .xdp: return 240
+    case .xdssc: return 15
+    case .xdw: return 321
+    case .xenc: return 215
+    case .xer: return 57
+    case .xfdf: return 241
+    case .xfdl: return 575
+    case .xht: return 216
+    case .xhtml: return 216
+    case .xhvml: return 223
+    case .xif: return 676
+    case .xla: return 420
+    case .xlam: return 421
+    case .xlc: return 420
+    case .xlf: return 209
+    case .xlm: return 420
+    case .xls: return 420
+    case .xlsb: return 422
+    case .xlsm: return 423
+    case .xlsx: return 484
+    case .xlt: return 420
+    case .xltm: return 424
+    case .xltx: return 485
+    case .xlw: return 420
+    case .xm: return 606
+    case .xml: return 217
+    case .xo: return 477
+    case .xop: return 219
+    case .xpi: return 210
+    case .xpl: return 220
+    case .xpm: return 658
+    case .xpr: return 369
+    case .xps: return 443
+    case .xpw: return 363
+    case .xpx: return 363
+    case .xsl: return 217
+    case .xslt: return 221
+    case .xsm: return 548
+    case .xspf: return 222
+    case .xul: return 417
+    case .xvm: return 223
+    case .xvml: return 223
+    case .xwd: return 659
+    case .xyz: return 623
+    case .xz: return 211
+    case .yang: return 224
+    case .yin: return 225
+    case .z1: return 212
+    case .z2: return 212
+    case .z3: return 212
+    case .z4: return 212
+    case .z5: return 212
+    case .z6: return 212
+    case .z7: return 212
+    case .z8: return 212
+    case .zaz: return 585
+    case .zip: return 226
+    case .zir: return 584
+    case .zirz: return 584
+    case .zmm: return 344
+    }
   }
 }
 
-internal let _mimeType_to_ext: [MIMEType._Core: Set<MIMEType.PathExtension>] = [
-  MIMEType._Core(type: .application, tree: nil, subtype: "andrew-inset", suffix: nil): [.ez],
-  MIMEType._Core(type: .application, tree: nil, subtype: "applixware", suffix: nil): [.aw],
-  MIMEType._Core(type: .application, tree: nil, subtype: "atom", suffix: .xml): [.atom],
-  MIMEType._Core(type: .application, tree: nil, subtype: "atomcat", suffix: .xml): [.atomcat],
-  MIMEType._Core(type: .application, tree: nil, subtype: "atomsvc", suffix: .xml): [.atomsvc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "ccxml", suffix: .xml): [.ccxml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-capability", suffix: nil): [.cdmia],
-  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-container", suffix: nil): [.cdmic],
-  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-domain", suffix: nil): [.cdmid],
-  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-object", suffix: nil): [.cdmio],
-  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-queue", suffix: nil): [.cdmiq],
-  MIMEType._Core(type: .application, tree: nil, subtype: "cu-seeme", suffix: nil): [.cu],
-  MIMEType._Core(type: .application, tree: nil, subtype: "davmount", suffix: .xml): [.davmount],
-  MIMEType._Core(type: .application, tree: nil, subtype: "docbook", suffix: .xml): [.dbk],
-  MIMEType._Core(type: .application, tree: nil, subtype: "dssc", suffix: .der): [.dssc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "dssc", suffix: .xml): [.xdssc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "ecmascript", suffix: nil): [.ecma],
-  MIMEType._Core(type: .application, tree: nil, subtype: "emma", suffix: .xml): [.emma],
-  MIMEType._Core(type: .application, tree: nil, subtype: "epub", suffix: .zip): [.epub],
-  MIMEType._Core(type: .application, tree: nil, subtype: "exi", suffix: nil): [.exi],
-  MIMEType._Core(type: .application, tree: nil, subtype: "font-tdpfr", suffix: nil): [.pfr],
-  MIMEType._Core(type: .application, tree: nil, subtype: "gml", suffix: .xml): [.gml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "gpx", suffix: .xml): [.gpx],
-  MIMEType._Core(type: .application, tree: nil, subtype: "gxf", suffix: nil): [.gxf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "hyperstudio", suffix: nil): [.stk],
-  MIMEType._Core(type: .application, tree: nil, subtype: "inkml", suffix: .xml): [.ink, .inkml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "ipfix", suffix: nil): [.ipfix],
-  MIMEType._Core(type: .application, tree: nil, subtype: "java-archive", suffix: nil): [.jar],
-  MIMEType._Core(type: .application, tree: nil, subtype: "java-serialized-object", suffix: nil): [.ser],
-  MIMEType._Core(type: .application, tree: nil, subtype: "java-vm", suffix: nil): [.`class`],
-  MIMEType._Core(type: .application, tree: nil, subtype: "json", suffix: nil): [.json],
-  MIMEType._Core(type: .application, tree: nil, subtype: "jsonml", suffix: .json): [.jsonml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "lost", suffix: .xml): [.lostxml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mac-binhex40", suffix: nil): [.hqx],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mac-compactpro", suffix: nil): [.cpt],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mads", suffix: .xml): [.mads],
-  MIMEType._Core(type: .application, tree: nil, subtype: "marc", suffix: nil): [.mrc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "marcxml", suffix: .xml): [.mrcx],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mathematica", suffix: nil): [.ma, .mb, .nb],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mathml", suffix: .xml): [.mathml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mbox", suffix: nil): [.mbox],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mediaservercontrol", suffix: .xml): [.mscml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "metalink", suffix: .xml): [.metalink],
-  MIMEType._Core(type: .application, tree: nil, subtype: "metalink4", suffix: .xml): [.meta4],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mets", suffix: .xml): [.mets],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mods", suffix: .xml): [.mods],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mp21", suffix: nil): [.m21, .mp21],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mp4", suffix: nil): [.mp4s],
-  MIMEType._Core(type: .application, tree: nil, subtype: "msword", suffix: nil): [.doc, .dot],
-  MIMEType._Core(type: .application, tree: nil, subtype: "mxf", suffix: nil): [.mxf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil): [.bin, .bpk, .deploy, .dist, .distz, .dms, .dump, .elc, .lrf, .mar, .pkg, .so],
-  MIMEType._Core(type: .application, tree: nil, subtype: "oda", suffix: nil): [.oda],
-  MIMEType._Core(type: .application, tree: nil, subtype: "oebps-package", suffix: .xml): [.opf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "ogg", suffix: nil): [.ogx],
-  MIMEType._Core(type: .application, tree: nil, subtype: "omdoc", suffix: .xml): [.omdoc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "onenote", suffix: nil): [.onepkg, .onetmp, .onetoc, .onetoc2],
-  MIMEType._Core(type: .application, tree: nil, subtype: "oxps", suffix: nil): [.oxps],
-  MIMEType._Core(type: .application, tree: nil, subtype: "patch-ops-error", suffix: .xml): [.xer],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pdf", suffix: nil): [.pdf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pgp-encrypted", suffix: nil): [.pgp],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pgp-signature", suffix: nil): [.asc, .sig],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pics-rules", suffix: nil): [.prf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pkcs10", suffix: nil): [.p10],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pkcs7-mime", suffix: nil): [.p7c, .p7m],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pkcs7-signature", suffix: nil): [.p7s],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pkcs8", suffix: nil): [.p8],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pkix-attr-cert", suffix: nil): [.ac],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pkix-cert", suffix: nil): [.cer],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pkix-crl", suffix: nil): [.crl],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pkix-pkipath", suffix: nil): [.pkipath],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pkixcmp", suffix: nil): [.pki],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pls", suffix: .xml): [.pls],
-  MIMEType._Core(type: .application, tree: nil, subtype: "postscript", suffix: nil): [.ai, .eps, .ps],
-  MIMEType._Core(type: .application, tree: nil, subtype: "pskc", suffix: .xml): [.pskcxml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "rdf", suffix: .xml): [.rdf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "reginfo", suffix: .xml): [.rif],
-  MIMEType._Core(type: .application, tree: nil, subtype: "relax-ng-compact-syntax", suffix: nil): [.rnc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "resource-lists", suffix: .xml): [.rl],
-  MIMEType._Core(type: .application, tree: nil, subtype: "resource-lists-diff", suffix: .xml): [.rld],
-  MIMEType._Core(type: .application, tree: nil, subtype: "rls-services", suffix: .xml): [.rs],
-  MIMEType._Core(type: .application, tree: nil, subtype: "rpki-ghostbusters", suffix: nil): [.gbr],
-  MIMEType._Core(type: .application, tree: nil, subtype: "rpki-manifest", suffix: nil): [.mft],
-  MIMEType._Core(type: .application, tree: nil, subtype: "rpki-roa", suffix: nil): [.roa],
-  MIMEType._Core(type: .application, tree: nil, subtype: "rsd", suffix: .xml): [.rsd],
-  MIMEType._Core(type: .application, tree: nil, subtype: "rss", suffix: .xml): [.rss],
-  MIMEType._Core(type: .application, tree: nil, subtype: "rtf", suffix: nil): [.rtf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "sbml", suffix: .xml): [.sbml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "scvp-cv-request", suffix: nil): [.scq],
-  MIMEType._Core(type: .application, tree: nil, subtype: "scvp-cv-response", suffix: nil): [.scs],
-  MIMEType._Core(type: .application, tree: nil, subtype: "scvp-vp-request", suffix: nil): [.spq],
-  MIMEType._Core(type: .application, tree: nil, subtype: "scvp-vp-response", suffix: nil): [.spp],
-  MIMEType._Core(type: .application, tree: nil, subtype: "sdp", suffix: nil): [.sdp],
-  MIMEType._Core(type: .application, tree: nil, subtype: "set-payment-initiation", suffix: nil): [.setpay],
-  MIMEType._Core(type: .application, tree: nil, subtype: "set-registration-initiation", suffix: nil): [.setreg],
-  MIMEType._Core(type: .application, tree: nil, subtype: "shf", suffix: .xml): [.shf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "smil", suffix: .xml): [.smi, .smil],
-  MIMEType._Core(type: .application, tree: nil, subtype: "sparql-query", suffix: nil): [.rq],
-  MIMEType._Core(type: .application, tree: nil, subtype: "sparql-results", suffix: .xml): [.srx],
-  MIMEType._Core(type: .application, tree: nil, subtype: "srgs", suffix: nil): [.gram],
-  MIMEType._Core(type: .application, tree: nil, subtype: "srgs", suffix: .xml): [.grxml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "sru", suffix: .xml): [.sru],
-  MIMEType._Core(type: .application, tree: nil, subtype: "ssdl", suffix: .xml): [.ssdl],
-  MIMEType._Core(type: .application, tree: nil, subtype: "ssml", suffix: .xml): [.ssml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "tei", suffix: .xml): [.tei, .teicorpus],
-  MIMEType._Core(type: .application, tree: nil, subtype: "thraud", suffix: .xml): [.tfi],
-  MIMEType._Core(type: .application, tree: nil, subtype: "timestamped-data", suffix: nil): [.tsd],
-  MIMEType._Core(type: .application, tree: nil, subtype: "voicexml", suffix: .xml): [.vxml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "wasm", suffix: nil): [.wasm],
-  MIMEType._Core(type: .application, tree: nil, subtype: "widget", suffix: nil): [.wgt],
-  MIMEType._Core(type: .application, tree: nil, subtype: "winhlp", suffix: nil): [.hlp],
-  MIMEType._Core(type: .application, tree: nil, subtype: "wsdl", suffix: .xml): [.wsdl],
-  MIMEType._Core(type: .application, tree: nil, subtype: "wspolicy", suffix: .xml): [.wspolicy],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-7z-compressed", suffix: nil): [._7z],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-abiword", suffix: nil): [.abw],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-ace-compressed", suffix: nil): [.ace],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-apple-diskimage", suffix: nil): [.dmg],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-bin", suffix: nil): [.aab, .u32, .vox, .x32],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-map", suffix: nil): [.aam],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-seg", suffix: nil): [.aas],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-bcpio", suffix: nil): [.bcpio],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-bittorrent", suffix: nil): [.torrent],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-blorb", suffix: nil): [.blb, .blorb],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-bzip", suffix: nil): [.bz],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-bzip2", suffix: nil): [.boz, .bz2],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-cbr", suffix: nil): [.cb7, .cba, .cbr, .cbt, .cbz],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-cdlink", suffix: nil): [.vcd],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-cfs-compressed", suffix: nil): [.cfs],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-chat", suffix: nil): [.chat],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-chess-pgn", suffix: nil): [.pgn],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-conference", suffix: nil): [.nsc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-cpio", suffix: nil): [.cpio],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-csh", suffix: nil): [.csh],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-debian-package", suffix: nil): [.deb, .udeb],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-dgc-compressed", suffix: nil): [.dgc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil): [.cct, .cst, .cxt, .dcr, .dir, .dxr, .fgd, .swa, .w3d],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-doom", suffix: nil): [.wad],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-dtbncx", suffix: .xml): [.ncx],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-dtbook", suffix: .xml): [.dtb],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-dtbresource", suffix: .xml): [.res],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-dvi", suffix: nil): [.dvi],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-envoy", suffix: nil): [.evy],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-eva", suffix: nil): [.eva],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-bdf", suffix: nil): [.bdf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-ghostscript", suffix: nil): [.gsf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-linux-psf", suffix: nil): [.psf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-pcf", suffix: nil): [.pcf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-snf", suffix: nil): [.snf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-type1", suffix: nil): [.afm, .pfa, .pfb, .pfm],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-freearc", suffix: nil): [.arc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-futuresplash", suffix: nil): [.spl],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-gca-compressed", suffix: nil): [.gca],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-glulx", suffix: nil): [.ulx],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-gnumeric", suffix: nil): [.gnumeric],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-gramps-xml", suffix: nil): [.gramps],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-gtar", suffix: nil): [.gtar],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-hdf", suffix: nil): [.hdf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-install-instructions", suffix: nil): [.install],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-iso9660-image", suffix: nil): [.iso],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-java-jnlp-file", suffix: nil): [.jnlp],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-latex", suffix: nil): [.latex],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-lzh-compressed", suffix: nil): [.lha, .lzh],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-mie", suffix: nil): [.mie],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-mobipocket-ebook", suffix: nil): [.mobi, .prc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-application", suffix: nil): [.application],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-shortcut", suffix: nil): [.lnk],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-wmd", suffix: nil): [.wmd],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-wmz", suffix: nil): [.wmz],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-xbap", suffix: nil): [.xbap],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-msaccess", suffix: nil): [.mdb],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-msbinder", suffix: nil): [.obd],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-mscardfile", suffix: nil): [.crd],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-msclip", suffix: nil): [.clp],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-msdownload", suffix: nil): [.bat, .com, .dll, .exe, .msi],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-msmediaview", suffix: nil): [.m13, .m14, .mvb],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-msmetafile", suffix: nil): [.emf, .emz, .wmf, .wmz],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-msmoney", suffix: nil): [.mny],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-mspublisher", suffix: nil): [.pub],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-msschedule", suffix: nil): [.scd],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-msterminal", suffix: nil): [.trm],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-mswrite", suffix: nil): [.wri],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-netcdf", suffix: nil): [.cdf, .nc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-nzb", suffix: nil): [.nzb],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs12", suffix: nil): [.p12, .pfx],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs7-certificates", suffix: nil): [.p7b, .spc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs7-certreqresp", suffix: nil): [.p7r],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-rar-compressed", suffix: nil): [.rar],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-research-info-systems", suffix: nil): [.ris],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-sh", suffix: nil): [.sh],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-shar", suffix: nil): [.shar],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-shockwave-flash", suffix: nil): [.swf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-silverlight-app", suffix: nil): [.xap],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-sql", suffix: nil): [.sql],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-stuffit", suffix: nil): [.sit],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-stuffitx", suffix: nil): [.sitx],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-subrip", suffix: nil): [.srt],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-sv4cpio", suffix: nil): [.sv4cpio],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-sv4crc", suffix: nil): [.sv4crc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-t3vm-image", suffix: nil): [.t3],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-tads", suffix: nil): [.gam],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-tar", suffix: nil): [.tar],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-tcl", suffix: nil): [.tcl],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-tex", suffix: nil): [.tex],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-tex-tfm", suffix: nil): [.tfm],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-texinfo", suffix: nil): [.texi, .texinfo],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-tgif", suffix: nil): [.obj],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-ustar", suffix: nil): [.ustar],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-wais-source", suffix: nil): [.src],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-x509-ca-cert", suffix: nil): [.crt, .der],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-xfig", suffix: nil): [.fig],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-xliff", suffix: .xml): [.xlf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-xpinstall", suffix: nil): [.xpi],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-xz", suffix: nil): [.xz],
-  MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil): [.z1, .z2, .z3, .z4, .z5, .z6, .z7, .z8],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xaml", suffix: .xml): [.xaml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xcap-diff", suffix: .xml): [.xdf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xenc", suffix: .xml): [.xenc],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xhtml", suffix: .xml): [.xht, .xhtml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xml", suffix: nil): [.xml, .xsl],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xml-dtd", suffix: nil): [.dtd],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xop", suffix: .xml): [.xop],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xproc", suffix: .xml): [.xpl],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xslt", suffix: .xml): [.xslt],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xspf", suffix: .xml): [.xspf],
-  MIMEType._Core(type: .application, tree: nil, subtype: "xv", suffix: .xml): [.mxml, .xhvml, .xvm, .xvml],
-  MIMEType._Core(type: .application, tree: nil, subtype: "yang", suffix: nil): [.yang],
-  MIMEType._Core(type: .application, tree: nil, subtype: "yin", suffix: .xml): [.yin],
-  MIMEType._Core(type: .application, tree: nil, subtype: "zip", suffix: nil): [.zip],
-  MIMEType._Core(type: .application, tree: .prs, subtype: "cww", suffix: nil): [.cww],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp.pic-bw-large", suffix: nil): [.plb],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp.pic-bw-small", suffix: nil): [.psb],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp.pic-bw-var", suffix: nil): [.pvb],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp2.tcap", suffix: nil): [.tcap],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "3m.post-it-notes", suffix: nil): [.pwn],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "accpac.simply.aso", suffix: nil): [.aso],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "accpac.simply.imp", suffix: nil): [.imp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "acucobol", suffix: nil): [.acu],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "acucorp", suffix: nil): [.acutc, .atc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.air-application-installer-package", suffix: .zip): [.air],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.formscentral.fcdt", suffix: nil): [.fcdt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.fxp", suffix: nil): [.fxp, .fxpl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.xdp", suffix: .xml): [.xdp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.xfdf", suffix: nil): [.xfdf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ahead.space", suffix: nil): [.ahead],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "airzip.filesecure.azf", suffix: nil): [.azf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "airzip.filesecure.azs", suffix: nil): [.azs],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "amazon.ebook", suffix: nil): [.azw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "americandynamics.acc", suffix: nil): [.acc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "amiga.ami", suffix: nil): [.ami],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "android.package-archive", suffix: nil): [.apk],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "anser-web-certificate-issue-initiation", suffix: nil): [.cii],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "anser-web-funds-transfer-initiation", suffix: nil): [.fti],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "antix.game-component", suffix: nil): [.atx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "apple.installer", suffix: .xml): [.mpkg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "apple.mpegurl", suffix: nil): [.m3u8],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "aristanetworks.swi", suffix: nil): [.swi],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "astraea-software.iota", suffix: nil): [.iota],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "audiograph", suffix: nil): [.aep],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "blueice.multipass", suffix: nil): [.mpm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "bmi", suffix: nil): [.bmi],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "businessobjects", suffix: nil): [.rep],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "chemdraw", suffix: .xml): [.cdxml],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "chipnuts.karaoke-mmd", suffix: nil): [.mmd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "cinderella", suffix: nil): [.cdy],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "claymore", suffix: nil): [.cla],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "cloanto.rp9", suffix: nil): [.rp9],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "clonk.c4group", suffix: nil): [.c4d, .c4f, .c4g, .c4p, .c4u],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "cluetrust.cartomobile-config", suffix: nil): [.c11amc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "cluetrust.cartomobile-config-pkg", suffix: nil): [.c11amz],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "commonspace", suffix: nil): [.csp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "contact.cmsg", suffix: nil): [.cdbcmsg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "cosmocaller", suffix: nil): [.cmc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker", suffix: nil): [.clkx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.keyboard", suffix: nil): [.clkk],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.palette", suffix: nil): [.clkp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.template", suffix: nil): [.clkt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.wordbank", suffix: nil): [.clkw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "criticaltools.wbs", suffix: .xml): [.wbs],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ctc-posml", suffix: nil): [.pml],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "cups-ppd", suffix: nil): [.ppd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "curl.car", suffix: nil): [.car],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "curl.pcurl", suffix: nil): [.pcurl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dart", suffix: nil): [.dart],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "data-vision.rdz", suffix: nil): [.rdz],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.data", suffix: nil): [.uvd, .uvf, .uvvd, .uvvf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.ttml", suffix: .xml): [.uvt, .uvvt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.unspecified", suffix: nil): [.uvvx, .uvx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.zip", suffix: nil): [.uvvz, .uvz],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "denovo.fcselayout-link", suffix: nil): [.feLaunch],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dna", suffix: nil): [.dna],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dolby.mlp", suffix: nil): [.mlp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dpgraph", suffix: nil): [.dpg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dreamfactory", suffix: nil): [.dfac],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ds-keypoint", suffix: nil): [.kpxx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dvb.ait", suffix: nil): [.ait],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dvb.service", suffix: nil): [.svc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "dynageo", suffix: nil): [.geo],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ecowin.chart", suffix: nil): [.mag],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "enliven", suffix: nil): [.nml],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.esf", suffix: nil): [.esf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.msf", suffix: nil): [.msf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.quickanime", suffix: nil): [.qam],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.salt", suffix: nil): [.slt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.ssf", suffix: nil): [.ssf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "eszigno3", suffix: .xml): [.es3, .et3],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ezpix-album", suffix: nil): [.ez2],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ezpix-package", suffix: nil): [.ez3],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fdf", suffix: nil): [.fdf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fdsn.mseed", suffix: nil): [.mseed],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fdsn.seed", suffix: nil): [.dataless, .seed],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "flographit", suffix: nil): [.gph],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fluxtime.clip", suffix: nil): [.ftc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "framemaker", suffix: nil): [.book, .fm, .frame, .maker],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "frogans.fnc", suffix: nil): [.fnc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "frogans.ltf", suffix: nil): [.ltf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fsc.weblaunch", suffix: nil): [.fsc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasys", suffix: nil): [.oas],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasys2", suffix: nil): [.oa2],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasys3", suffix: nil): [.oa3],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasysgp", suffix: nil): [.fg5],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasysprs", suffix: nil): [.bh2],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujixerox.ddd", suffix: nil): [.ddd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujixerox.docuworks", suffix: nil): [.xdw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujixerox.docuworks.binder", suffix: nil): [.xbd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "fuzzysheet", suffix: nil): [.fzs],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "genomatix.tuxedo", suffix: nil): [.txd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "geogebra.file", suffix: nil): [.ggb],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "geogebra.slides", suffix: nil): [.ggs],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "geogebra.tool", suffix: nil): [.ggt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "geometry-explorer", suffix: nil): [.gex, .gre],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "geonext", suffix: nil): [.gxt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "geoplan", suffix: nil): [.g2w],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "geospace", suffix: nil): [.g3w],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "gmx", suffix: nil): [.gmx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "google-earth.kml", suffix: .xml): [.kml],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "google-earth.kmz", suffix: nil): [.kmz],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "grafeq", suffix: nil): [.gqf, .gqs],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-account", suffix: nil): [.gac],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-help", suffix: nil): [.ghf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-identity-message", suffix: nil): [.gim],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-injector", suffix: nil): [.grv],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-tool-message", suffix: nil): [.gtm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-tool-template", suffix: nil): [.tpl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-vcard", suffix: nil): [.vcg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hal", suffix: .xml): [.hal],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "handheld-entertainment", suffix: .xml): [.zmm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hbci", suffix: nil): [.hbci],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hhe.lesson-player", suffix: nil): [.les],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-hpgl", suffix: nil): [.hpgl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-hpid", suffix: nil): [.hpid],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-hps", suffix: nil): [.hps],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-jlyt", suffix: nil): [.jlt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-pcl", suffix: nil): [.pcl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-pclxl", suffix: nil): [.pclxl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "hydrostatix.sof-data", suffix: nil): [.sfdHdstx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.minipay", suffix: nil): [.mpy],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.modcap", suffix: nil): [.afp, .list3820, .listafp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.rights-management", suffix: nil): [.irm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.secure-container", suffix: nil): [.sc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "iccprofile", suffix: nil): [.icc, .icm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "igloader", suffix: nil): [.igl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "immervision-ivp", suffix: nil): [.ivp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "immervision-ivu", suffix: nil): [.ivu],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "insors.igm", suffix: nil): [.igm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "intercon.formnet", suffix: nil): [.xpw, .xpx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "intergeo", suffix: nil): [.i2g],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "intu.qbo", suffix: nil): [.qbo],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "intu.qfx", suffix: nil): [.qfx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ipunplugged.rcprofile", suffix: nil): [.rcprofile],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "irepository.package", suffix: .xml): [.irp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "is-xpr", suffix: nil): [.xpr],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "isac.fcs", suffix: nil): [.fcs],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "jam", suffix: nil): [.jam],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "jcp.javame.midlet-rms", suffix: nil): [.rms],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "jisp", suffix: nil): [.jisp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "joost.joda-archive", suffix: nil): [.joda],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kahootz", suffix: nil): [.ktr, .ktz],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.karbon", suffix: nil): [.karbon],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kchart", suffix: nil): [.chrt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kformula", suffix: nil): [.kfo],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kivio", suffix: nil): [.flw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kontour", suffix: nil): [.kon],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kpresenter", suffix: nil): [.kpr, .kpt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kspread", suffix: nil): [.ksp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kword", suffix: nil): [.kwd, .kwt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kenameaapp", suffix: nil): [.htke],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kidspiration", suffix: nil): [.kia],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kinar", suffix: nil): [.kne, .knp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "koan", suffix: nil): [.skd, .skm, .skp, .skt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "kodak-descriptor", suffix: nil): [.sse],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "las.las", suffix: .xml): [.lasxml],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "llamagraphics.life-balance.desktop", suffix: nil): [.lbd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "llamagraphics.life-balance.exchange", suffix: .xml): [.lbe],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-1-2-3", suffix: nil): [._123],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-approach", suffix: nil): [.apr],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-freelance", suffix: nil): [.pre],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-notes", suffix: nil): [.nsf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-organizer", suffix: nil): [.org],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-screencam", suffix: nil): [.scm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-wordpro", suffix: nil): [.lwp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "macports.portpkg", suffix: nil): [.portpkg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mcd", suffix: nil): [.mcd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "medcalcdata", suffix: nil): [.mc1],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mediastation.cdkey", suffix: nil): [.cdkey],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mfer", suffix: nil): [.mwf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mfmp", suffix: nil): [.mfm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "micrografx.flo", suffix: nil): [.flo],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "micrografx.igx", suffix: nil): [.igx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mif", suffix: nil): [.mif],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.daf", suffix: nil): [.daf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.dis", suffix: nil): [.dis],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.mbk", suffix: nil): [.mbk],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.mqy", suffix: nil): [.mqy],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.msl", suffix: nil): [.msl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.plc", suffix: nil): [.plc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.txf", suffix: nil): [.txf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mophun.application", suffix: nil): [.mpn],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mophun.certificate", suffix: nil): [.mpc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mozilla.xul", suffix: .xml): [.xul],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-artgalry", suffix: nil): [.cil],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-cab-compressed", suffix: nil): [.cab],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel", suffix: nil): [.xla, .xlc, .xlm, .xls, .xlt, .xlw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.addin.macroenabled.12", suffix: nil): [.xlam],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.sheet.binary.macroenabled.12", suffix: nil): [.xlsb],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.sheet.macroenabled.12", suffix: nil): [.xlsm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.template.macroenabled.12", suffix: nil): [.xltm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-fontobject", suffix: nil): [.eot],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-htmlhelp", suffix: nil): [.chm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-ims", suffix: nil): [.ims],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-lrm", suffix: nil): [.lrm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-officetheme", suffix: nil): [.thmx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-pki.seccat", suffix: nil): [.cat],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-pki.stl", suffix: nil): [.stl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint", suffix: nil): [.pot, .pps, .ppt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.addin.macroenabled.12", suffix: nil): [.ppam],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.presentation.macroenabled.12", suffix: nil): [.pptm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.slide.macroenabled.12", suffix: nil): [.sldm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.slideshow.macroenabled.12", suffix: nil): [.ppsm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.template.macroenabled.12", suffix: nil): [.potm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-project", suffix: nil): [.mpp, .mpt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-word.document.macroenabled.12", suffix: nil): [.docm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-word.template.macroenabled.12", suffix: nil): [.dotm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-works", suffix: nil): [.wcm, .wdb, .wks, .wps],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-wpl", suffix: nil): [.wpl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-xpsdocument", suffix: nil): [.xps],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mseq", suffix: nil): [.mseq],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "musician", suffix: nil): [.mus],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "muvee.style", suffix: nil): [.msty],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "mynfc", suffix: nil): [.taglet],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "neurolanguage.nlu", suffix: nil): [.nlu],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "nitf", suffix: nil): [.nitf, .ntf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "noblenet-directory", suffix: nil): [.nnd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "noblenet-sealer", suffix: nil): [.nns],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "noblenet-web", suffix: nil): [.nnw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.n-gage.data", suffix: nil): [.ngdat],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.n-gage.symbian.install", suffix: nil): [.nGage],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.radio-preset", suffix: nil): [.rpst],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.radio-presets", suffix: nil): [.rpss],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "novadigm.edm", suffix: nil): [.edm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "novadigm.edx", suffix: nil): [.edx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "novadigm.ext", suffix: nil): [.ext],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.chart", suffix: nil): [.odc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.chart-template", suffix: nil): [.otc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.database", suffix: nil): [.odb],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.formula", suffix: nil): [.odf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.formula-template", suffix: nil): [.odft],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.graphics", suffix: nil): [.odg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.graphics-template", suffix: nil): [.otg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.image", suffix: nil): [.odi],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.image-template", suffix: nil): [.oti],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.presentation", suffix: nil): [.odp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.presentation-template", suffix: nil): [.otp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.spreadsheet", suffix: nil): [.ods],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.spreadsheet-template", suffix: nil): [.ots],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text", suffix: nil): [.odt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text-master", suffix: nil): [.odm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text-template", suffix: nil): [.ott],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text-web", suffix: nil): [.oth],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "olpc-sugar", suffix: nil): [.xo],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "oma.dd2", suffix: .xml): [.dd2],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "openofficeorg.extension", suffix: nil): [.oxt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.presentation", suffix: nil): [.pptx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.slide", suffix: nil): [.sldx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.slideshow", suffix: nil): [.ppsx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.template", suffix: nil): [.potx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.spreadsheetml.sheet", suffix: nil): [.xlsx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.spreadsheetml.template", suffix: nil): [.xltx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.wordprocessingml.document", suffix: nil): [.docx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.wordprocessingml.template", suffix: nil): [.dotx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "osgeo.mapguide.package", suffix: nil): [.mgp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "osgi.dp", suffix: nil): [.dp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "osgi.subsystem", suffix: nil): [.esa],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "palm", suffix: nil): [.oprc, .pdb, .pqa],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "pawaafile", suffix: nil): [.paw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "pg.format", suffix: nil): [.str],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "pg.osasli", suffix: nil): [.ei6],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "picsel", suffix: nil): [.efif],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "pmi.widget", suffix: nil): [.wg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "pocketlearn", suffix: nil): [.plf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "powerbuilder6", suffix: nil): [.pbd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "previewsystems.box", suffix: nil): [.box],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "proteus.magazine", suffix: nil): [.mgz],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "publishare-delta-tree", suffix: nil): [.qps],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "pvi.ptid1", suffix: nil): [.ptid],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "quark.quarkxpress", suffix: nil): [.qwd, .qwt, .qxb, .qxd, .qxl, .qxt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "realvnc.bed", suffix: nil): [.bed],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "recordare.musicxml", suffix: nil): [.mxl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "recordare.musicxml", suffix: .xml): [.musicxml],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "rig.cryptonote", suffix: nil): [.cryptonote],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "rim.cod", suffix: nil): [.cod],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "rn-realmedia", suffix: nil): [.rm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "rn-realmedia-vbr", suffix: nil): [.rmvb],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "route66.link66", suffix: .xml): [.link66],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sailingtracker.track", suffix: nil): [.st],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "seemail", suffix: nil): [.see],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sema", suffix: nil): [.sema],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "semd", suffix: nil): [.semd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "semf", suffix: nil): [.semf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.formdata", suffix: nil): [.ifm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.formtemplate", suffix: nil): [.itp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.interchange", suffix: nil): [.iif],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.package", suffix: nil): [.ipk],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "simtech-mindmapper", suffix: nil): [.twd, .twds],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "smaf", suffix: nil): [.mmf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "smart.teacher", suffix: nil): [.teacher],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "solent.sdkm", suffix: .xml): [.sdkd, .sdkm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "spotfire.dxp", suffix: nil): [.dxp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "spotfire.sfs", suffix: nil): [.sfs],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.calc", suffix: nil): [.sdc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.draw", suffix: nil): [.sda],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.impress", suffix: nil): [.sdd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.math", suffix: nil): [.smf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.writer", suffix: nil): [.sdw, .vor],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.writer-global", suffix: nil): [.sgl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "stepmania.package", suffix: nil): [.smzip],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "stepmania.stepchart", suffix: nil): [.sm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.calc", suffix: nil): [.sxc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.calc.template", suffix: nil): [.stc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.draw", suffix: nil): [.sxd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.draw.template", suffix: nil): [.std],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.impress", suffix: nil): [.sxi],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.impress.template", suffix: nil): [.sti],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.math", suffix: nil): [.sxm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.writer", suffix: nil): [.sxw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.writer.global", suffix: nil): [.sxg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.writer.template", suffix: nil): [.stw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "sus-calendar", suffix: nil): [.sus, .susp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "svd", suffix: nil): [.svd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "symbian.install", suffix: nil): [.sis, .sisx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "syncml", suffix: .xml): [.xsm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "syncml.dm", suffix: .wbxml): [.bdm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "syncml.dm", suffix: .xml): [.xdm],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "tao.intent-module-archive", suffix: nil): [.tao],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "tcpdump.pcap", suffix: nil): [.cap, .dmp, .pcap],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "tmobile-livetv", suffix: nil): [.tmo],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "trid.tpt", suffix: nil): [.tpt],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "triscape.mxs", suffix: nil): [.mxs],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "trueapp", suffix: nil): [.tra],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "ufdl", suffix: nil): [.ufd, .ufdl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "uiq.theme", suffix: nil): [.utz],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "umajin", suffix: nil): [.umj],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "unity", suffix: nil): [.unityweb],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "uoml", suffix: .xml): [.uoml],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "vcx", suffix: nil): [.vcx],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "visio", suffix: nil): [.vsd, .vss, .vst, .vsw],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "visionary", suffix: nil): [.vis],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "vsf", suffix: nil): [.vsf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "wap.wbxml", suffix: nil): [.wbxml],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "wap.wmlc", suffix: nil): [.wmlc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "wap.wmlscriptc", suffix: nil): [.wmlsc],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "webturbo", suffix: nil): [.wtb],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "wolfram.player", suffix: nil): [.nbp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "wordperfect", suffix: nil): [.wpd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "wqd", suffix: nil): [.wqd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "wt.stf", suffix: nil): [.stf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "xara", suffix: nil): [.xar],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "xfdl", suffix: nil): [.xfdl],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.hv-dic", suffix: nil): [.hvd],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.hv-script", suffix: nil): [.hvs],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.hv-voice", suffix: nil): [.hvp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.openscoreformat", suffix: nil): [.osf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.openscoreformat.osfpvg", suffix: .xml): [.osfpvg],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.smaf-audio", suffix: nil): [.saf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.smaf-phrase", suffix: nil): [.spf],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "yellowriver-custom-menu", suffix: nil): [.cmp],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "zul", suffix: nil): [.zir, .zirz],
-  MIMEType._Core(type: .application, tree: .vnd, subtype: "zzazz.deck", suffix: .xml): [.zaz],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "adpcm", suffix: nil): [.adp],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "basic", suffix: nil): [.au, .snd],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "midi", suffix: nil): [.kar, .mid, .midi, .rmi],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "mp4", suffix: nil): [.m4a, .mp4a],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "mpeg", suffix: nil): [.m2a, .m3a, .mp2, .mp2a, .mp3, .mpga],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "ogg", suffix: nil): [.oga, .ogg, .opus, .spx],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "s3m", suffix: nil): [.s3m],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "silk", suffix: nil): [.sil],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "webm", suffix: nil): [.weba],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-aac", suffix: nil): [.aac],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-aiff", suffix: nil): [.aif, .aifc, .aiff],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-caf", suffix: nil): [.caf],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-flac", suffix: nil): [.flac],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-matroska", suffix: nil): [.mka],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-mpegurl", suffix: nil): [.m3u],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-ms-wax", suffix: nil): [.wax],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-ms-wma", suffix: nil): [.wma],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-pn-realaudio", suffix: nil): [.ra, .ram],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-pn-realaudio-plugin", suffix: nil): [.rmp],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "x-wav", suffix: nil): [.wav],
-  MIMEType._Core(type: .audio, tree: nil, subtype: "xm", suffix: nil): [.xm],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "dece.audio", suffix: nil): [.uva, .uvva],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "digital-winds", suffix: nil): [.eol],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "dra", suffix: nil): [.dra],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "dts", suffix: nil): [.dts],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "dts.hd", suffix: nil): [.dtshd],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "lucent.voice", suffix: nil): [.lvp],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "ms-playready.media.pya", suffix: nil): [.pya],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "nuera.ecelp4800", suffix: nil): [.ecelp4800],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "nuera.ecelp7470", suffix: nil): [.ecelp7470],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "nuera.ecelp9600", suffix: nil): [.ecelp9600],
-  MIMEType._Core(type: .audio, tree: .vnd, subtype: "rip", suffix: nil): [.rip],
-  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cdx", suffix: nil): [.cdx],
-  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cif", suffix: nil): [.cif],
-  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cmdf", suffix: nil): [.cmdf],
-  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cml", suffix: nil): [.cml],
-  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-csml", suffix: nil): [.csml],
-  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-xyz", suffix: nil): [.xyz],
-  MIMEType._Core(type: .font, tree: nil, subtype: "collection", suffix: nil): [.ttc],
-  MIMEType._Core(type: .font, tree: nil, subtype: "otf", suffix: nil): [.otf],
-  MIMEType._Core(type: .font, tree: nil, subtype: "ttf", suffix: nil): [.ttf],
-  MIMEType._Core(type: .font, tree: nil, subtype: "woff", suffix: nil): [.woff],
-  MIMEType._Core(type: .font, tree: nil, subtype: "woff2", suffix: nil): [.woff2],
-  MIMEType._Core(type: .image, tree: nil, subtype: "avif", suffix: nil): [.avif],
-  MIMEType._Core(type: .image, tree: nil, subtype: "bmp", suffix: nil): [.bmp],
-  MIMEType._Core(type: .image, tree: nil, subtype: "cgm", suffix: nil): [.cgm],
-  MIMEType._Core(type: .image, tree: nil, subtype: "g3fax", suffix: nil): [.g3],
-  MIMEType._Core(type: .image, tree: nil, subtype: "gif", suffix: nil): [.gif],
-  MIMEType._Core(type: .image, tree: nil, subtype: "ief", suffix: nil): [.ief],
-  MIMEType._Core(type: .image, tree: nil, subtype: "jpeg", suffix: nil): [.jpe, .jpeg, .jpg],
-  MIMEType._Core(type: .image, tree: nil, subtype: "jxl", suffix: nil): [.jxl],
-  MIMEType._Core(type: .image, tree: nil, subtype: "ktx", suffix: nil): [.ktx],
-  MIMEType._Core(type: .image, tree: nil, subtype: "png", suffix: nil): [.png],
-  MIMEType._Core(type: .image, tree: nil, subtype: "sgi", suffix: nil): [.sgi],
-  MIMEType._Core(type: .image, tree: nil, subtype: "svg", suffix: .xml): [.svg, .svgz],
-  MIMEType._Core(type: .image, tree: nil, subtype: "tiff", suffix: nil): [.tif, .tiff],
-  MIMEType._Core(type: .image, tree: nil, subtype: "webp", suffix: nil): [.webp],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-3ds", suffix: nil): [._3ds],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-cmu-raster", suffix: nil): [.ras],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-cmx", suffix: nil): [.cmx],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-freehand", suffix: nil): [.fh, .fh4, .fh5, .fh7, .fhc],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-icon", suffix: nil): [.ico],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-mrsid-image", suffix: nil): [.sid],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-pcx", suffix: nil): [.pcx],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-pict", suffix: nil): [.pct, .pic],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-anymap", suffix: nil): [.pnm],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-bitmap", suffix: nil): [.pbm],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-graymap", suffix: nil): [.pgm],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-pixmap", suffix: nil): [.ppm],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-rgb", suffix: nil): [.rgb],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-tga", suffix: nil): [.tga],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-xbitmap", suffix: nil): [.xbm],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-xpixmap", suffix: nil): [.xpm],
-  MIMEType._Core(type: .image, tree: nil, subtype: "x-xwindowdump", suffix: nil): [.xwd],
-  MIMEType._Core(type: .image, tree: .prs, subtype: "btif", suffix: nil): [.btif],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "adobe.photoshop", suffix: nil): [.psd],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "dece.graphic", suffix: nil): [.uvg, .uvi, .uvvg, .uvvi],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "djvu", suffix: nil): [.djv, .djvu],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "dvb.subtitle", suffix: nil): [.sub],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "dwg", suffix: nil): [.dwg],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "dxf", suffix: nil): [.dxf],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "fastbidsheet", suffix: nil): [.fbs],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "fpx", suffix: nil): [.fpx],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "fst", suffix: nil): [.fst],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "fujixerox.edmics-mmr", suffix: nil): [.mmr],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "fujixerox.edmics-rlc", suffix: nil): [.rlc],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "ms-modi", suffix: nil): [.mdi],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "ms-photo", suffix: nil): [.wdp],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "net-fpx", suffix: nil): [.npx],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "wap.wbmp", suffix: nil): [.wbmp],
-  MIMEType._Core(type: .image, tree: .vnd, subtype: "xiff", suffix: nil): [.xif],
-  MIMEType._Core(type: .message, tree: nil, subtype: "rfc822", suffix: nil): [.eml, .mime],
-  MIMEType._Core(type: .model, tree: nil, subtype: "iges", suffix: nil): [.iges, .igs],
-  MIMEType._Core(type: .model, tree: nil, subtype: "mesh", suffix: nil): [.mesh, .msh, .silo],
-  MIMEType._Core(type: .model, tree: nil, subtype: "vrml", suffix: nil): [.vrml, .wrl],
-  MIMEType._Core(type: .model, tree: nil, subtype: "x3d", suffix: .xml): [.x3d, .x3dz],
-  MIMEType._Core(type: .model, tree: nil, subtype: "x3d+binary", suffix: nil): [.x3db, .x3dbz],
-  MIMEType._Core(type: .model, tree: nil, subtype: "x3d+vrml", suffix: nil): [.x3dv, .x3dvz],
-  MIMEType._Core(type: .model, tree: .vnd, subtype: "collada", suffix: .xml): [.dae],
-  MIMEType._Core(type: .model, tree: .vnd, subtype: "dwf", suffix: nil): [.dwf],
-  MIMEType._Core(type: .model, tree: .vnd, subtype: "gdl", suffix: nil): [.gdl],
-  MIMEType._Core(type: .model, tree: .vnd, subtype: "gtw", suffix: nil): [.gtw],
-  MIMEType._Core(type: .model, tree: .vnd, subtype: "vtu", suffix: nil): [.vtu],
-  MIMEType._Core(type: .text, tree: nil, subtype: "cache-manifest", suffix: nil): [.appcache],
-  MIMEType._Core(type: .text, tree: nil, subtype: "calendar", suffix: nil): [.ics, .ifb],
-  MIMEType._Core(type: .text, tree: nil, subtype: "css", suffix: nil): [.css],
-  MIMEType._Core(type: .text, tree: nil, subtype: "csv", suffix: nil): [.csv],
-  MIMEType._Core(type: .text, tree: nil, subtype: "html", suffix: nil): [.htm, .html],
-  MIMEType._Core(type: .text, tree: nil, subtype: "javascript", suffix: nil): [.js, .mjs],
-  MIMEType._Core(type: .text, tree: nil, subtype: "n3", suffix: nil): [.n3],
-  MIMEType._Core(type: .text, tree: nil, subtype: "plain", suffix: nil): [.conf, .def, .`in`, .list, .log, .text, .txt],
-  MIMEType._Core(type: .text, tree: nil, subtype: "richtext", suffix: nil): [.rtx],
-  MIMEType._Core(type: .text, tree: nil, subtype: "sgml", suffix: nil): [.sgm, .sgml],
-  MIMEType._Core(type: .text, tree: nil, subtype: "tab-separated-values", suffix: nil): [.tsv],
-  MIMEType._Core(type: .text, tree: nil, subtype: "troff", suffix: nil): [.man, .me, .ms, .roff, .t, .tr],
-  MIMEType._Core(type: .text, tree: nil, subtype: "turtle", suffix: nil): [.ttl],
-  MIMEType._Core(type: .text, tree: nil, subtype: "uri-list", suffix: nil): [.uri, .uris, .urls],
-  MIMEType._Core(type: .text, tree: nil, subtype: "vcard", suffix: nil): [.vcard],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-asm", suffix: nil): [.asm, .s],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-c", suffix: nil): [.c, .cc, .cpp, .cxx, .dic, .h, .hh],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-fortran", suffix: nil): [.f, .f77, .f90, .`for`],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-java-source", suffix: nil): [.java],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-nfo", suffix: nil): [.nfo],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-opml", suffix: nil): [.opml],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-pascal", suffix: nil): [.p, .pas],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-setext", suffix: nil): [.etx],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-sfv", suffix: nil): [.sfv],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-uuencode", suffix: nil): [.uu],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-vcalendar", suffix: nil): [.vcs],
-  MIMEType._Core(type: .text, tree: nil, subtype: "x-vcard", suffix: nil): [.vcf],
-  MIMEType._Core(type: .text, tree: .prs, subtype: "lines.tag", suffix: nil): [.dsc],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "curl", suffix: nil): [.curl],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "curl.dcurl", suffix: nil): [.dcurl],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "curl.mcurl", suffix: nil): [.mcurl],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "curl.scurl", suffix: nil): [.scurl],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "dvb.subtitle", suffix: nil): [.sub],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "fly", suffix: nil): [.fly],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "fmi.flexstor", suffix: nil): [.flx],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "graphviz", suffix: nil): [.gv],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "in3d.3dml", suffix: nil): [._3dml],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "in3d.spot", suffix: nil): [.spot],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "sun.j2me.app-descriptor", suffix: nil): [.jad],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "wap.wml", suffix: nil): [.wml],
-  MIMEType._Core(type: .text, tree: .vnd, subtype: "wap.wmlscript", suffix: nil): [.wmls],
-  MIMEType._Core(type: .video, tree: nil, subtype: "3gpp", suffix: nil): [._3gp],
-  MIMEType._Core(type: .video, tree: nil, subtype: "3gpp2", suffix: nil): [._3g2],
-  MIMEType._Core(type: .video, tree: nil, subtype: "h261", suffix: nil): [.h261],
-  MIMEType._Core(type: .video, tree: nil, subtype: "h263", suffix: nil): [.h263],
-  MIMEType._Core(type: .video, tree: nil, subtype: "h264", suffix: nil): [.h264],
-  MIMEType._Core(type: .video, tree: nil, subtype: "jpeg", suffix: nil): [.jpgv],
-  MIMEType._Core(type: .video, tree: nil, subtype: "jpm", suffix: nil): [.jpgm, .jpm],
-  MIMEType._Core(type: .video, tree: nil, subtype: "mj2", suffix: nil): [.mj2, .mjp2],
-  MIMEType._Core(type: .video, tree: nil, subtype: "mp2t", suffix: nil): [.m2t, .m2ts, .mts, .ts],
-  MIMEType._Core(type: .video, tree: nil, subtype: "mp4", suffix: nil): [.mp4, .mp4v, .mpg4],
-  MIMEType._Core(type: .video, tree: nil, subtype: "mpeg", suffix: nil): [.m1v, .m2v, .mpe, .mpeg, .mpg],
-  MIMEType._Core(type: .video, tree: nil, subtype: "ogg", suffix: nil): [.ogv],
-  MIMEType._Core(type: .video, tree: nil, subtype: "quicktime", suffix: nil): [.mov, .qt],
-  MIMEType._Core(type: .video, tree: nil, subtype: "webm", suffix: nil): [.webm],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-f4v", suffix: nil): [.f4v],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-fli", suffix: nil): [.fli],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-flv", suffix: nil): [.flv],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-m4v", suffix: nil): [.m4v],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-matroska", suffix: nil): [.mk3d, .mks, .mkv],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-mng", suffix: nil): [.mng],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-asf", suffix: nil): [.asf, .asx],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-vob", suffix: nil): [.vob],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wm", suffix: nil): [.wm],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wmv", suffix: nil): [.wmv],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wmx", suffix: nil): [.wmx],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wvx", suffix: nil): [.wvx],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-msvideo", suffix: nil): [.avi],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-sgi-movie", suffix: nil): [.movie],
-  MIMEType._Core(type: .video, tree: nil, subtype: "x-smv", suffix: nil): [.smv],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.hd", suffix: nil): [.uvh, .uvvh],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.mobile", suffix: nil): [.uvm, .uvvm],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.pd", suffix: nil): [.uvp, .uvvp],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.sd", suffix: nil): [.uvs, .uvvs],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.video", suffix: nil): [.uvv, .uvvv],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "dvb.file", suffix: nil): [.dvb],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "fvt", suffix: nil): [.fvt],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "mpegurl", suffix: nil): [.m4u, .mxu],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "ms-playready.media.pyv", suffix: nil): [.pyv],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "uvvu.mp4", suffix: nil): [.uvu, .uvvu],
-  MIMEType._Core(type: .video, tree: .vnd, subtype: "vivo", suffix: nil): [.viv],
+internal let _internedMIMETypeCores: [MIMEType._Core] = [
+  MIMEType._Core(type: .application, tree: nil, subtype: "andrew-inset", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "applixware", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "atom", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "atomcat", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "atomsvc", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "ccxml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-capability", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-container", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-domain", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-object", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-queue", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "cu-seeme", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "davmount", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "docbook", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "dssc", suffix: .der),
+  MIMEType._Core(type: .application, tree: nil, subtype: "dssc", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "ecmascript", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "emma", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "epub", suffix: .zip),
+  MIMEType._Core(type: .application, tree: nil, subtype: "exi", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "font-tdpfr", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "gml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "gpx", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "gxf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "hyperstudio", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "inkml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "ipfix", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "java-archive", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "java-serialized-object", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "java-vm", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "json", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "jsonml", suffix: .json),
+  MIMEType._Core(type: .application, tree: nil, subtype: "lost", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mac-binhex40", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mac-compactpro", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mads", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "marc", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "marcxml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mathematica", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mathml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mbox", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mediaservercontrol", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "metalink", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "metalink4", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mets", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mods", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mp21", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mp4", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "msword", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "mxf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "oda", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "oebps-package", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "ogg", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "omdoc", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "onenote", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "oxps", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "patch-ops-error", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pdf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pgp-encrypted", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pgp-signature", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pics-rules", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pkcs10", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pkcs7-mime", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pkcs7-signature", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pkcs8", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pkix-attr-cert", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pkix-cert", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pkix-crl", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pkix-pkipath", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pkixcmp", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pls", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "postscript", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "pskc", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "rdf", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "reginfo", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "relax-ng-compact-syntax", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "resource-lists", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "resource-lists-diff", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "rls-services", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "rpki-ghostbusters", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "rpki-manifest", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "rpki-roa", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "rsd", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "rss", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "rtf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "sbml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "scvp-cv-request", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "scvp-cv-response", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "scvp-vp-request", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "scvp-vp-response", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "sdp", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "set-payment-initiation", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "set-registration-initiation", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "shf", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "smil", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "sparql-query", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "sparql-results", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "srgs", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "srgs", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "sru", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "ssdl", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "ssml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "tei", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "thraud", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "timestamped-data", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "voicexml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "wasm", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "widget", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "winhlp", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "wsdl", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "wspolicy", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-7z-compressed", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-abiword", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-ace-compressed", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-apple-diskimage", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-bin", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-map", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-seg", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-bcpio", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-bittorrent", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-blorb", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-bzip", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-bzip2", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-cbr", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-cdlink", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-cfs-compressed", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-chat", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-chess-pgn", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-conference", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-cpio", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-csh", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-debian-package", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-dgc-compressed", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-doom", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-dtbncx", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-dtbook", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-dtbresource", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-dvi", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-envoy", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-eva", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-bdf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-ghostscript", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-linux-psf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-pcf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-snf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-font-type1", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-freearc", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-futuresplash", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-gca-compressed", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-glulx", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-gnumeric", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-gramps-xml", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-gtar", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-hdf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-install-instructions", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-iso9660-image", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-java-jnlp-file", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-latex", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-lzh-compressed", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-mie", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-mobipocket-ebook", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-application", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-shortcut", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-wmd", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-wmz", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-xbap", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-msaccess", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-msbinder", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-mscardfile", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-msclip", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-msdownload", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-msmediaview", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-msmetafile", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-msmoney", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-mspublisher", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-msschedule", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-msterminal", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-mswrite", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-netcdf", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-nzb", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs12", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs7-certificates", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs7-certreqresp", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-rar-compressed", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-research-info-systems", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-sh", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-shar", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-shockwave-flash", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-silverlight-app", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-sql", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-stuffit", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-stuffitx", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-subrip", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-sv4cpio", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-sv4crc", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-t3vm-image", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-tads", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-tar", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-tcl", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-tex", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-tex-tfm", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-texinfo", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-tgif", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-ustar", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-wais-source", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-x509-ca-cert", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-xfig", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-xliff", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-xpinstall", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-xz", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xaml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xcap-diff", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xenc", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xhtml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xml", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xml-dtd", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xop", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xproc", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xslt", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xspf", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "xv", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "yang", suffix: nil),
+  MIMEType._Core(type: .application, tree: nil, subtype: "yin", suffix: .xml),
+  MIMEType._Core(type: .application, tree: nil, subtype: "zip", suffix: nil),
+  MIMEType._Core(type: .application, tree: .prs, subtype: "cww", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp.pic-bw-large", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp.pic-bw-small", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp.pic-bw-var", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp2.tcap", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "3m.post-it-notes", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "accpac.simply.aso", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "accpac.simply.imp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "acucobol", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "acucorp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.air-application-installer-package", suffix: .zip),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.formscentral.fcdt", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.fxp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.xdp", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.xfdf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ahead.space", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "airzip.filesecure.azf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "airzip.filesecure.azs", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "amazon.ebook", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "americandynamics.acc", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "amiga.ami", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "android.package-archive", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "anser-web-certificate-issue-initiation", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "anser-web-funds-transfer-initiation", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "antix.game-component", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "apple.installer", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "apple.mpegurl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "aristanetworks.swi", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "astraea-software.iota", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "audiograph", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "blueice.multipass", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "bmi", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "businessobjects", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "chemdraw", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "chipnuts.karaoke-mmd", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "cinderella", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "claymore", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "cloanto.rp9", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "clonk.c4group", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "cluetrust.cartomobile-config", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "cluetrust.cartomobile-config-pkg", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "commonspace", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "contact.cmsg", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "cosmocaller", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.keyboard", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.palette", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.wordbank", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "criticaltools.wbs", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ctc-posml", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "cups-ppd", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "curl.car", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "curl.pcurl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dart", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "data-vision.rdz", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.data", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.ttml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.unspecified", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.zip", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "denovo.fcselayout-link", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dna", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dolby.mlp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dpgraph", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dreamfactory", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ds-keypoint", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dvb.ait", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dvb.service", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "dynageo", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ecowin.chart", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "enliven", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.esf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.msf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.quickanime", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.salt", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.ssf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "eszigno3", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ezpix-album", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ezpix-package", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fdf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fdsn.mseed", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fdsn.seed", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "flographit", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fluxtime.clip", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "framemaker", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "frogans.fnc", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "frogans.ltf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fsc.weblaunch", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasys", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasys2", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasys3", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasysgp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasysprs", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujixerox.ddd", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujixerox.docuworks", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fujixerox.docuworks.binder", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "fuzzysheet", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "genomatix.tuxedo", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "geogebra.file", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "geogebra.slides", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "geogebra.tool", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "geometry-explorer", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "geonext", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "geoplan", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "geospace", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "gmx", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "google-earth.kml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "google-earth.kmz", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "grafeq", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-account", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-help", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-identity-message", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-injector", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-tool-message", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-tool-template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-vcard", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hal", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "handheld-entertainment", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hbci", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hhe.lesson-player", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-hpgl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-hpid", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-hps", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-jlyt", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-pcl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-pclxl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "hydrostatix.sof-data", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.minipay", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.modcap", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.rights-management", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.secure-container", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "iccprofile", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "igloader", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "immervision-ivp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "immervision-ivu", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "insors.igm", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "intercon.formnet", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "intergeo", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "intu.qbo", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "intu.qfx", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ipunplugged.rcprofile", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "irepository.package", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "is-xpr", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "isac.fcs", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "jam", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "jcp.javame.midlet-rms", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "jisp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "joost.joda-archive", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kahootz", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.karbon", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kchart", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kformula", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kivio", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kontour", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kpresenter", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kspread", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kword", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kenameaapp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kidspiration", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kinar", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "koan", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "kodak-descriptor", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "las.las", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "llamagraphics.life-balance.desktop", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "llamagraphics.life-balance.exchange", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-1-2-3", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-approach", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-freelance", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-notes", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-organizer", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-screencam", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-wordpro", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "macports.portpkg", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mcd", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "medcalcdata", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mediastation.cdkey", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mfer", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mfmp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "micrografx.flo", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "micrografx.igx", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mif", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.daf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.dis", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.mbk", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.mqy", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.msl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.plc", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.txf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mophun.application", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mophun.certificate", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mozilla.xul", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-artgalry", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-cab-compressed", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.addin.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.sheet.binary.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.sheet.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.template.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-fontobject", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-htmlhelp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-ims", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-lrm", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-officetheme", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-pki.seccat", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-pki.stl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.addin.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.presentation.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.slide.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.slideshow.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.template.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-project", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-word.document.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-word.template.macroenabled.12", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-works", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-wpl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-xpsdocument", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mseq", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "musician", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "muvee.style", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "mynfc", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "neurolanguage.nlu", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "nitf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "noblenet-directory", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "noblenet-sealer", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "noblenet-web", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.n-gage.data", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.n-gage.symbian.install", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.radio-preset", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.radio-presets", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "novadigm.edm", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "novadigm.edx", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "novadigm.ext", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.chart", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.chart-template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.database", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.formula", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.formula-template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.graphics", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.graphics-template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.image", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.image-template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.presentation", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.presentation-template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.spreadsheet", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.spreadsheet-template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text-master", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text-template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text-web", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "olpc-sugar", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "oma.dd2", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "openofficeorg.extension", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.presentation", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.slide", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.slideshow", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.spreadsheetml.sheet", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.spreadsheetml.template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.wordprocessingml.document", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.wordprocessingml.template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "osgeo.mapguide.package", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "osgi.dp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "osgi.subsystem", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "palm", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "pawaafile", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "pg.format", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "pg.osasli", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "picsel", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "pmi.widget", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "pocketlearn", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "powerbuilder6", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "previewsystems.box", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "proteus.magazine", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "publishare-delta-tree", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "pvi.ptid1", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "quark.quarkxpress", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "realvnc.bed", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "recordare.musicxml", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "recordare.musicxml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "rig.cryptonote", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "rim.cod", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "rn-realmedia", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "rn-realmedia-vbr", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "route66.link66", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sailingtracker.track", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "seemail", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sema", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "semd", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "semf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.formdata", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.formtemplate", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.interchange", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.package", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "simtech-mindmapper", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "smaf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "smart.teacher", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "solent.sdkm", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "spotfire.dxp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "spotfire.sfs", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.calc", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.draw", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.impress", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.math", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.writer", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.writer-global", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "stepmania.package", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "stepmania.stepchart", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.calc", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.calc.template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.draw", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.draw.template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.impress", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.impress.template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.math", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.writer", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.writer.global", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.writer.template", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "sus-calendar", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "svd", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "symbian.install", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "syncml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "syncml.dm", suffix: .wbxml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "syncml.dm", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "tao.intent-module-archive", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "tcpdump.pcap", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "tmobile-livetv", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "trid.tpt", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "triscape.mxs", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "trueapp", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "ufdl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "uiq.theme", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "umajin", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "unity", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "uoml", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "vcx", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "visio", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "visionary", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "vsf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "wap.wbxml", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "wap.wmlc", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "wap.wmlscriptc", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "webturbo", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "wolfram.player", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "wordperfect", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "wqd", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "wt.stf", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "xara", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "xfdl", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.hv-dic", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.hv-script", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.hv-voice", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.openscoreformat", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.openscoreformat.osfpvg", suffix: .xml),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.smaf-audio", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.smaf-phrase", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "yellowriver-custom-menu", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "zul", suffix: nil),
+  MIMEType._Core(type: .application, tree: .vnd, subtype: "zzazz.deck", suffix: .xml),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "adpcm", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "basic", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "midi", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "mp4", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "mpeg", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "ogg", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "s3m", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "silk", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "webm", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-aac", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-aiff", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-caf", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-flac", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-matroska", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-mpegurl", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-ms-wax", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-ms-wma", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-pn-realaudio", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-pn-realaudio-plugin", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "x-wav", suffix: nil),
+  MIMEType._Core(type: .audio, tree: nil, subtype: "xm", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "dece.audio", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "digital-winds", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "dra", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "dts", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "dts.hd", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "lucent.voice", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "ms-playready.media.pya", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "nuera.ecelp4800", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "nuera.ecelp7470", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "nuera.ecelp9600", suffix: nil),
+  MIMEType._Core(type: .audio, tree: .vnd, subtype: "rip", suffix: nil),
+  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cdx", suffix: nil),
+  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cif", suffix: nil),
+  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cmdf", suffix: nil),
+  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cml", suffix: nil),
+  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-csml", suffix: nil),
+  MIMEType._Core(type: .chemical, tree: nil, subtype: "x-xyz", suffix: nil),
+  MIMEType._Core(type: .font, tree: nil, subtype: "collection", suffix: nil),
+  MIMEType._Core(type: .font, tree: nil, subtype: "otf", suffix: nil),
+  MIMEType._Core(type: .font, tree: nil, subtype: "ttf", suffix: nil),
+  MIMEType._Core(type: .font, tree: nil, subtype: "woff", suffix: nil),
+  MIMEType._Core(type: .font, tree: nil, subtype: "woff2", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "avif", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "bmp", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "cgm", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "g3fax", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "gif", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "ief", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "jpeg", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "jxl", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "ktx", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "png", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "sgi", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "svg", suffix: .xml),
+  MIMEType._Core(type: .image, tree: nil, subtype: "tiff", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "webp", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-3ds", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-cmu-raster", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-cmx", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-freehand", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-icon", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-mrsid-image", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-pcx", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-pict", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-anymap", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-bitmap", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-graymap", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-pixmap", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-rgb", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-tga", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-xbitmap", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-xpixmap", suffix: nil),
+  MIMEType._Core(type: .image, tree: nil, subtype: "x-xwindowdump", suffix: nil),
+  MIMEType._Core(type: .image, tree: .prs, subtype: "btif", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "adobe.photoshop", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "dece.graphic", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "djvu", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "dvb.subtitle", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "dwg", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "dxf", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "fastbidsheet", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "fpx", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "fst", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "fujixerox.edmics-mmr", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "fujixerox.edmics-rlc", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "ms-modi", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "ms-photo", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "net-fpx", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "wap.wbmp", suffix: nil),
+  MIMEType._Core(type: .image, tree: .vnd, subtype: "xiff", suffix: nil),
+  MIMEType._Core(type: .message, tree: nil, subtype: "rfc822", suffix: nil),
+  MIMEType._Core(type: .model, tree: nil, subtype: "iges", suffix: nil),
+  MIMEType._Core(type: .model, tree: nil, subtype: "mesh", suffix: nil),
+  MIMEType._Core(type: .model, tree: nil, subtype: "vrml", suffix: nil),
+  MIMEType._Core(type: .model, tree: nil, subtype: "x3d", suffix: .xml),
+  MIMEType._Core(type: .model, tree: nil, subtype: "x3d+binary", suffix: nil),
+  MIMEType._Core(type: .model, tree: nil, subtype: "x3d+vrml", suffix: nil),
+  MIMEType._Core(type: .model, tree: .vnd, subtype: "collada", suffix: .xml),
+  MIMEType._Core(type: .model, tree: .vnd, subtype: "dwf", suffix: nil),
+  MIMEType._Core(type: .model, tree: .vnd, subtype: "gdl", suffix: nil),
+  MIMEType._Core(type: .model, tree: .vnd, subtype: "gtw", suffix: nil),
+  MIMEType._Core(type: .model, tree: .vnd, subtype: "vtu", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "cache-manifest", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "calendar", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "css", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "csv", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "html", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "javascript", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "n3", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "plain", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "richtext", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "sgml", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "tab-separated-values", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "troff", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "turtle", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "uri-list", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "vcard", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-asm", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-c", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-fortran", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-java-source", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-nfo", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-opml", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-pascal", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-setext", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-sfv", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-uuencode", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-vcalendar", suffix: nil),
+  MIMEType._Core(type: .text, tree: nil, subtype: "x-vcard", suffix: nil),
+  MIMEType._Core(type: .text, tree: .prs, subtype: "lines.tag", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "curl", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "curl.dcurl", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "curl.mcurl", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "curl.scurl", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "dvb.subtitle", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "fly", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "fmi.flexstor", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "graphviz", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "in3d.3dml", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "in3d.spot", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "sun.j2me.app-descriptor", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "wap.wml", suffix: nil),
+  MIMEType._Core(type: .text, tree: .vnd, subtype: "wap.wmlscript", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "3gpp", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "3gpp2", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "h261", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "h263", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "h264", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "jpeg", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "jpm", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "mj2", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "mp2t", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "mp4", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "mpeg", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "ogg", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "quicktime", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "webm", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-f4v", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-fli", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-flv", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-m4v", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-matroska", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-mng", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-asf", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-vob", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wm", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wmv", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wmx", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wvx", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-msvideo", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-sgi-movie", suffix: nil),
+  MIMEType._Core(type: .video, tree: nil, subtype: "x-smv", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.hd", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.mobile", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.pd", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.sd", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.video", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "dvb.file", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "fvt", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "mpegurl", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "ms-playready.media.pyv", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "uvvu.mp4", suffix: nil),
+  MIMEType._Core(type: .video, tree: .vnd, subtype: "vivo", suffix: nil),
+]
+
+internal let _internedMIMETypeStrings: [String] = [
+  "application/andrew-inset",
+  "application/applixware",
+  "application/atom+xml",
+  "application/atomcat+xml",
+  "application/atomsvc+xml",
+  "application/ccxml+xml",
+  "application/cdmi-capability",
+  "application/cdmi-container",
+  "application/cdmi-domain",
+  "application/cdmi-object",
+  "application/cdmi-queue",
+  "application/cu-seeme",
+  "application/davmount+xml",
+  "application/docbook+xml",
+  "application/dssc+der",
+  "application/dssc+xml",
+  "application/ecmascript",
+  "application/emma+xml",
+  "application/epub+zip",
+  "application/exi",
+  "application/font-tdpfr",
+  "application/gml+xml",
+  "application/gpx+xml",
+  "application/gxf",
+  "application/hyperstudio",
+  "application/inkml+xml",
+  "application/ipfix",
+  "application/java-archive",
+  "application/java-serialized-object",
+  "application/java-vm",
+  "application/json",
+  "application/jsonml+json",
+  "application/lost+xml",
+  "application/mac-binhex40",
+  "application/mac-compactpro",
+  "application/mads+xml",
+  "application/marc",
+  "application/marcxml+xml",
+  "application/mathematica",
+  "application/mathml+xml",
+  "application/mbox",
+  "application/mediaservercontrol+xml",
+  "application/metalink+xml",
+  "application/metalink4+xml",
+  "application/mets+xml",
+  "application/mods+xml",
+  "application/mp21",
+  "application/mp4",
+  "application/msword",
+  "application/mxf",
+  "application/octet-stream",
+  "application/oda",
+  "application/oebps-package+xml",
+  "application/ogg",
+  "application/omdoc+xml",
+  "application/onenote",
+  "application/oxps",
+  "application/patch-ops-error+xml",
+  "application/pdf",
+  "application/pgp-encrypted",
+  "application/pgp-signature",
+  "application/pics-rules",
+  "application/pkcs10",
+  "application/pkcs7-mime",
+  "application/pkcs7-signature",
+  "application/pkcs8",
+  "application/pkix-attr-cert",
+  "application/pkix-cert",
+  "application/pkix-crl",
+  "application/pkix-pkipath",
+  "application/pkixcmp",
+  "application/pls+xml",
+  "application/postscript",
+  "application/pskc+xml",
+  "application/rdf+xml",
+  "application/reginfo+xml",
+  "application/relax-ng-compact-syntax",
+  "application/resource-lists+xml",
+  "application/resource-lists-diff+xml",
+  "application/rls-services+xml",
+  "application/rpki-ghostbusters",
+  "application/rpki-manifest",
+  "application/rpki-roa",
+  "application/rsd+xml",
+  "application/rss+xml",
+  "application/rtf",
+  "application/sbml+xml",
+  "application/scvp-cv-request",
+  "application/scvp-cv-response",
+  "application/scvp-vp-request",
+  "application/scvp-vp-response",
+  "application/sdp",
+  "application/set-payment-initiation",
+  "application/set-registration-initiation",
+  "application/shf+xml",
+  "application/smil+xml",
+  "application/sparql-query",
+  "application/sparql-results+xml",
+  "application/srgs",
+  "application/srgs+xml",
+  "application/sru+xml",
+  "application/ssdl+xml",
+  "application/ssml+xml",
+  "application/tei+xml",
+  "application/thraud+xml",
+  "application/timestamped-data",
+  "application/voicexml+xml",
+  "application/wasm",
+  "application/widget",
+  "application/winhlp",
+  "application/wsdl+xml",
+  "application/wspolicy+xml",
+  "application/x-7z-compressed",
+  "application/x-abiword",
+  "application/x-ace-compressed",
+  "application/x-apple-diskimage",
+  "application/x-authorware-bin",
+  "application/x-authorware-map",
+  "application/x-authorware-seg",
+  "application/x-bcpio",
+  "application/x-bittorrent",
+  "application/x-blorb",
+  "application/x-bzip",
+  "application/x-bzip2",
+  "application/x-cbr",
+  "application/x-cdlink",
+  "application/x-cfs-compressed",
+  "application/x-chat",
+  "application/x-chess-pgn",
+  "application/x-conference",
+  "application/x-cpio",
+  "application/x-csh",
+  "application/x-debian-package",
+  "application/x-dgc-compressed",
+  "application/x-director",
+  "application/x-doom",
+  "application/x-dtbncx+xml",
+  "application/x-dtbook+xml",
+  "application/x-dtbresource+xml",
+  "application/x-dvi",
+  "application/x-envoy",
+  "application/x-eva",
+  "application/x-font-bdf",
+  "application/x-font-ghostscript",
+  "application/x-font-linux-psf",
+  "application/x-font-pcf",
+  "application/x-font-snf",
+  "application/x-font-type1",
+  "application/x-freearc",
+  "application/x-futuresplash",
+  "application/x-gca-compressed",
+  "application/x-glulx",
+  "application/x-gnumeric",
+  "application/x-gramps-xml",
+  "application/x-gtar",
+  "application/x-hdf",
+  "application/x-install-instructions",
+  "application/x-iso9660-image",
+  "application/x-java-jnlp-file",
+  "application/x-latex",
+  "application/x-lzh-compressed",
+  "application/x-mie",
+  "application/x-mobipocket-ebook",
+  "application/x-ms-application",
+  "application/x-ms-shortcut",
+  "application/x-ms-wmd",
+  "application/x-ms-wmz",
+  "application/x-ms-xbap",
+  "application/x-msaccess",
+  "application/x-msbinder",
+  "application/x-mscardfile",
+  "application/x-msclip",
+  "application/x-msdownload",
+  "application/x-msmediaview",
+  "application/x-msmetafile",
+  "application/x-msmoney",
+  "application/x-mspublisher",
+  "application/x-msschedule",
+  "application/x-msterminal",
+  "application/x-mswrite",
+  "application/x-netcdf",
+  "application/x-nzb",
+  "application/x-pkcs12",
+  "application/x-pkcs7-certificates",
+  "application/x-pkcs7-certreqresp",
+  "application/x-rar-compressed",
+  "application/x-research-info-systems",
+  "application/x-sh",
+  "application/x-shar",
+  "application/x-shockwave-flash",
+  "application/x-silverlight-app",
+  "application/x-sql",
+  "application/x-stuffit",
+  "application/x-stuffitx",
+  "application/x-subrip",
+  "application/x-sv4cpio",
+  "application/x-sv4crc",
+  "application/x-t3vm-image",
+  "application/x-tads",
+  "application/x-tar",
+  "application/x-tcl",
+  "application/x-tex",
+  "application/x-tex-tfm",
+  "application/x-texinfo",
+  "application/x-tgif",
+  "application/x-ustar",
+  "application/x-wais-source",
+  "application/x-x509-ca-cert",
+  "application/x-xfig",
+  "application/x-xliff+xml",
+  "application/x-xpinstall",
+  "application/x-xz",
+  "application/x-zmachine",
+  "application/xaml+xml",
+  "application/xcap-diff+xml",
+  "application/xenc+xml",
+  "application/xhtml+xml",
+  "application/xml",
+  "application/xml-dtd",
+  "application/xop+xml",
+  "application/xproc+xml",
+  "application/xslt+xml",
+  "application/xspf+xml",
+  "application/xv+xml",
+  "application/yang",
+  "application/yin+xml",
+  "application/zip",
+  "application/prs.cww",
+  "application/vnd.3gpp.pic-bw-large",
+  "application/vnd.3gpp.pic-bw-small",
+  "application/vnd.3gpp.pic-bw-var",
+  "application/vnd.3gpp2.tcap",
+  "application/vnd.3m.post-it-notes",
+  "application/vnd.accpac.simply.aso",
+  "application/vnd.accpac.simply.imp",
+  "application/vnd.acucobol",
+  "application/vnd.acucorp",
+  "application/vnd.adobe.air-application-installer-package+zip",
+  "application/vnd.adobe.formscentral.fcdt",
+  "application/vnd.adobe.fxp",
+  "application/vnd.adobe.xdp+xml",
+  "application/vnd.adobe.xfdf",
+  "application/vnd.ahead.space",
+  "application/vnd.airzip.filesecure.azf",
+  "application/vnd.airzip.filesecure.azs",
+  "application/vnd.amazon.ebook",
+  "application/vnd.americandynamics.acc",
+  "application/vnd.amiga.ami",
+  "application/vnd.android.package-archive",
+  "application/vnd.anser-web-certificate-issue-initiation",
+  "application/vnd.anser-web-funds-transfer-initiation",
+  "application/vnd.antix.game-component",
+  "application/vnd.apple.installer+xml",
+  "application/vnd.apple.mpegurl",
+  "application/vnd.aristanetworks.swi",
+  "application/vnd.astraea-software.iota",
+  "application/vnd.audiograph",
+  "application/vnd.blueice.multipass",
+  "application/vnd.bmi",
+  "application/vnd.businessobjects",
+  "application/vnd.chemdraw+xml",
+  "application/vnd.chipnuts.karaoke-mmd",
+  "application/vnd.cinderella",
+  "application/vnd.claymore",
+  "application/vnd.cloanto.rp9",
+  "application/vnd.clonk.c4group",
+  "application/vnd.cluetrust.cartomobile-config",
+  "application/vnd.cluetrust.cartomobile-config-pkg",
+  "application/vnd.commonspace",
+  "application/vnd.contact.cmsg",
+  "application/vnd.cosmocaller",
+  "application/vnd.crick.clicker",
+  "application/vnd.crick.clicker.keyboard",
+  "application/vnd.crick.clicker.palette",
+  "application/vnd.crick.clicker.template",
+  "application/vnd.crick.clicker.wordbank",
+  "application/vnd.criticaltools.wbs+xml",
+  "application/vnd.ctc-posml",
+  "application/vnd.cups-ppd",
+  "application/vnd.curl.car",
+  "application/vnd.curl.pcurl",
+  "application/vnd.dart",
+  "application/vnd.data-vision.rdz",
+  "application/vnd.dece.data",
+  "application/vnd.dece.ttml+xml",
+  "application/vnd.dece.unspecified",
+  "application/vnd.dece.zip",
+  "application/vnd.denovo.fcselayout-link",
+  "application/vnd.dna",
+  "application/vnd.dolby.mlp",
+  "application/vnd.dpgraph",
+  "application/vnd.dreamfactory",
+  "application/vnd.ds-keypoint",
+  "application/vnd.dvb.ait",
+  "application/vnd.dvb.service",
+  "application/vnd.dynageo",
+  "application/vnd.ecowin.chart",
+  "application/vnd.enliven",
+  "application/vnd.epson.esf",
+  "application/vnd.epson.msf",
+  "application/vnd.epson.quickanime",
+  "application/vnd.epson.salt",
+  "application/vnd.epson.ssf",
+  "application/vnd.eszigno3+xml",
+  "application/vnd.ezpix-album",
+  "application/vnd.ezpix-package",
+  "application/vnd.fdf",
+  "application/vnd.fdsn.mseed",
+  "application/vnd.fdsn.seed",
+  "application/vnd.flographit",
+  "application/vnd.fluxtime.clip",
+  "application/vnd.framemaker",
+  "application/vnd.frogans.fnc",
+  "application/vnd.frogans.ltf",
+  "application/vnd.fsc.weblaunch",
+  "application/vnd.fujitsu.oasys",
+  "application/vnd.fujitsu.oasys2",
+  "application/vnd.fujitsu.oasys3",
+  "application/vnd.fujitsu.oasysgp",
+  "application/vnd.fujitsu.oasysprs",
+  "application/vnd.fujixerox.ddd",
+  "application/vnd.fujixerox.docuworks",
+  "application/vnd.fujixerox.docuworks.binder",
+  "application/vnd.fuzzysheet",
+  "application/vnd.genomatix.tuxedo",
+  "application/vnd.geogebra.file",
+  "application/vnd.geogebra.slides",
+  "application/vnd.geogebra.tool",
+  "application/vnd.geometry-explorer",
+  "application/vnd.geonext",
+  "application/vnd.geoplan",
+  "application/vnd.geospace",
+  "application/vnd.gmx",
+  "application/vnd.google-earth.kml+xml",
+  "application/vnd.google-earth.kmz",
+  "application/vnd.grafeq",
+  "application/vnd.groove-account",
+  "application/vnd.groove-help",
+  "application/vnd.groove-identity-message",
+  "application/vnd.groove-injector",
+  "application/vnd.groove-tool-message",
+  "application/vnd.groove-tool-template",
+  "application/vnd.groove-vcard",
+  "application/vnd.hal+xml",
+  "application/vnd.handheld-entertainment+xml",
+  "application/vnd.hbci",
+  "application/vnd.hhe.lesson-player",
+  "application/vnd.hp-hpgl",
+  "application/vnd.hp-hpid",
+  "application/vnd.hp-hps",
+  "application/vnd.hp-jlyt",
+  "application/vnd.hp-pcl",
+  "application/vnd.hp-pclxl",
+  "application/vnd.hydrostatix.sof-data",
+  "application/vnd.ibm.minipay",
+  "application/vnd.ibm.modcap",
+  "application/vnd.ibm.rights-management",
+  "application/vnd.ibm.secure-container",
+  "application/vnd.iccprofile",
+  "application/vnd.igloader",
+  "application/vnd.immervision-ivp",
+  "application/vnd.immervision-ivu",
+  "application/vnd.insors.igm",
+  "application/vnd.intercon.formnet",
+  "application/vnd.intergeo",
+  "application/vnd.intu.qbo",
+  "application/vnd.intu.qfx",
+  "application/vnd.ipunplugged.rcprofile",
+  "application/vnd.irepository.package+xml",
+  "application/vnd.is-xpr",
+  "application/vnd.isac.fcs",
+  "application/vnd.jam",
+  "application/vnd.jcp.javame.midlet-rms",
+  "application/vnd.jisp",
+  "application/vnd.joost.joda-archive",
+  "application/vnd.kahootz",
+  "application/vnd.kde.karbon",
+  "application/vnd.kde.kchart",
+  "application/vnd.kde.kformula",
+  "application/vnd.kde.kivio",
+  "application/vnd.kde.kontour",
+  "application/vnd.kde.kpresenter",
+  "application/vnd.kde.kspread",
+  "application/vnd.kde.kword",
+  "application/vnd.kenameaapp",
+  "application/vnd.kidspiration",
+  "application/vnd.kinar",
+  "application/vnd.koan",
+  "application/vnd.kodak-descriptor",
+  "application/vnd.las.las+xml",
+  "application/vnd.llamagraphics.life-balance.desktop",
+  "application/vnd.llamagraphics.life-balance.exchange+xml",
+  "application/vnd.lotus-1-2-3",
+  "application/vnd.lotus-approach",
+  "application/vnd.lotus-freelance",
+  "application/vnd.lotus-notes",
+  "application/vnd.lotus-organizer",
+  "application/vnd.lotus-screencam",
+  "application/vnd.lotus-wordpro",
+  "application/vnd.macports.portpkg",
+  "application/vnd.mcd",
+  "application/vnd.medcalcdata",
+  "application/vnd.mediastation.cdkey",
+  "application/vnd.mfer",
+  "application/vnd.mfmp",
+  "application/vnd.micrografx.flo",
+  "application/vnd.micrografx.igx",
+  "application/vnd.mif",
+  "application/vnd.mobius.daf",
+  "application/vnd.mobius.dis",
+  "application/vnd.mobius.mbk",
+  "application/vnd.mobius.mqy",
+  "application/vnd.mobius.msl",
+  "application/vnd.mobius.plc",
+  "application/vnd.mobius.txf",
+  "application/vnd.mophun.application",
+  "application/vnd.mophun.certificate",
+  "application/vnd.mozilla.xul+xml",
+  "application/vnd.ms-artgalry",
+  "application/vnd.ms-cab-compressed",
+  "application/vnd.ms-excel",
+  "application/vnd.ms-excel.addin.macroenabled.12",
+  "application/vnd.ms-excel.sheet.binary.macroenabled.12",
+  "application/vnd.ms-excel.sheet.macroenabled.12",
+  "application/vnd.ms-excel.template.macroenabled.12",
+  "application/vnd.ms-fontobject",
+  "application/vnd.ms-htmlhelp",
+  "application/vnd.ms-ims",
+  "application/vnd.ms-lrm",
+  "application/vnd.ms-officetheme",
+  "application/vnd.ms-pki.seccat",
+  "application/vnd.ms-pki.stl",
+  "application/vnd.ms-powerpoint",
+  "application/vnd.ms-powerpoint.addin.macroenabled.12",
+  "application/vnd.ms-powerpoint.presentation.macroenabled.12",
+  "application/vnd.ms-powerpoint.slide.macroenabled.12",
+  "application/vnd.ms-powerpoint.slideshow.macroenabled.12",
+  "application/vnd.ms-powerpoint.template.macroenabled.12",
+  "application/vnd.ms-project",
+  "application/vnd.ms-word.document.macroenabled.12",
+  "application/vnd.ms-word.template.macroenabled.12",
+  "application/vnd.ms-works",
+  "application/vnd.ms-wpl",
+  "application/vnd.ms-xpsdocument",
+  "application/vnd.mseq",
+  "application/vnd.musician",
+  "application/vnd.muvee.style",
+  "application/vnd.mynfc",
+  "application/vnd.neurolanguage.nlu",
+  "application/vnd.nitf",
+  "application/vnd.noblenet-directory",
+  "application/vnd.noblenet-sealer",
+  "application/vnd.noblenet-web",
+  "application/vnd.nokia.n-gage.data",
+  "application/vnd.nokia.n-gage.symbian.install",
+  "application/vnd.nokia.radio-preset",
+  "application/vnd.nokia.radio-presets",
+  "application/vnd.novadigm.edm",
+  "application/vnd.novadigm.edx",
+  "application/vnd.novadigm.ext",
+  "application/vnd.oasis.opendocument.chart",
+  "application/vnd.oasis.opendocument.chart-template",
+  "application/vnd.oasis.opendocument.database",
+  "application/vnd.oasis.opendocument.formula",
+  "application/vnd.oasis.opendocument.formula-template",
+  "application/vnd.oasis.opendocument.graphics",
+  "application/vnd.oasis.opendocument.graphics-template",
+  "application/vnd.oasis.opendocument.image",
+  "application/vnd.oasis.opendocument.image-template",
+  "application/vnd.oasis.opendocument.presentation",
+  "application/vnd.oasis.opendocument.presentation-template",
+  "application/vnd.oasis.opendocument.spreadsheet",
+  "application/vnd.oasis.opendocument.spreadsheet-template",
+  "application/vnd.oasis.opendocument.text",
+  "application/vnd.oasis.opendocument.text-master",
+  "application/vnd.oasis.opendocument.text-template",
+  "application/vnd.oasis.opendocument.text-web",
+  "application/vnd.olpc-sugar",
+  "application/vnd.oma.dd2+xml",
+  "application/vnd.openofficeorg.extension",
+  "application/vnd.openxmlformats-officedocument.presentationml.presentation",
+  "application/vnd.openxmlformats-officedocument.presentationml.slide",
+  "application/vnd.openxmlformats-officedocument.presentationml.slideshow",
+  "application/vnd.openxmlformats-officedocument.presentationml.template",
+  "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet",
+  "application/vnd.openxmlformats-officedocument.spreadsheetml.template",
+  "application/vnd.openxmlformats-officedocument.wordprocessingml.document",
+  "application/vnd.openxmlformats-officedocument.wordprocessingml.template",
+  "application/vnd.osgeo.mapguide.package",
+  "application/vnd.osgi.dp",
+  "application/vnd.osgi.subsystem",
+  "application/vnd.palm",
+  "application/vnd.pawaafile",
+  "application/vnd.pg.format",
+  "application/vnd.pg.osasli",
+  "application/vnd.picsel",
+  "application/vnd.pmi.widget",
+  "application/vnd.pocketlearn",
+  "application/vnd.powerbuilder6",
+  "application/vnd.previewsystems.box",
+  "application/vnd.proteus.magazine",
+  "application/vnd.publishare-delta-tree",
+  "application/vnd.pvi.ptid1",
+  "application/vnd.quark.quarkxpress",
+  "application/vnd.realvnc.bed",
+  "application/vnd.recordare.musicxml",
+  "application/vnd.recordare.musicxml+xml",
+  "application/vnd.rig.cryptonote",
+  "application/vnd.rim.cod",
+  "application/vnd.rn-realmedia",
+  "application/vnd.rn-realmedia-vbr",
+  "application/vnd.route66.link66+xml",
+  "application/vnd.sailingtracker.track",
+  "application/vnd.seemail",
+  "application/vnd.sema",
+  "application/vnd.semd",
+  "application/vnd.semf",
+  "application/vnd.shana.informed.formdata",
+  "application/vnd.shana.informed.formtemplate",
+  "application/vnd.shana.informed.interchange",
+  "application/vnd.shana.informed.package",
+  "application/vnd.simtech-mindmapper",
+  "application/vnd.smaf",
+  "application/vnd.smart.teacher",
+  "application/vnd.solent.sdkm+xml",
+  "application/vnd.spotfire.dxp",
+  "application/vnd.spotfire.sfs",
+  "application/vnd.stardivision.calc",
+  "application/vnd.stardivision.draw",
+  "application/vnd.stardivision.impress",
+  "application/vnd.stardivision.math",
+  "application/vnd.stardivision.writer",
+  "application/vnd.stardivision.writer-global",
+  "application/vnd.stepmania.package",
+  "application/vnd.stepmania.stepchart",
+  "application/vnd.sun.xml.calc",
+  "application/vnd.sun.xml.calc.template",
+  "application/vnd.sun.xml.draw",
+  "application/vnd.sun.xml.draw.template",
+  "application/vnd.sun.xml.impress",
+  "application/vnd.sun.xml.impress.template",
+  "application/vnd.sun.xml.math",
+  "application/vnd.sun.xml.writer",
+  "application/vnd.sun.xml.writer.global",
+  "application/vnd.sun.xml.writer.template",
+  "application/vnd.sus-calendar",
+  "application/vnd.svd",
+  "application/vnd.symbian.install",
+  "application/vnd.syncml+xml",
+  "application/vnd.syncml.dm+wbxml",
+  "application/vnd.syncml.dm+xml",
+  "application/vnd.tao.intent-module-archive",
+  "application/vnd.tcpdump.pcap",
+  "application/vnd.tmobile-livetv",
+  "application/vnd.trid.tpt",
+  "application/vnd.triscape.mxs",
+  "application/vnd.trueapp",
+  "application/vnd.ufdl",
+  "application/vnd.uiq.theme",
+  "application/vnd.umajin",
+  "application/vnd.unity",
+  "application/vnd.uoml+xml",
+  "application/vnd.vcx",
+  "application/vnd.visio",
+  "application/vnd.visionary",
+  "application/vnd.vsf",
+  "application/vnd.wap.wbxml",
+  "application/vnd.wap.wmlc",
+  "application/vnd.wap.wmlscriptc",
+  "application/vnd.webturbo",
+  "application/vnd.wolfram.player",
+  "application/vnd.wordperfect",
+  "application/vnd.wqd",
+  "application/vnd.wt.stf",
+  "application/vnd.xara",
+  "application/vnd.xfdl",
+  "application/vnd.yamaha.hv-dic",
+  "application/vnd.yamaha.hv-script",
+  "application/vnd.yamaha.hv-voice",
+  "application/vnd.yamaha.openscoreformat",
+  "application/vnd.yamaha.openscoreformat.osfpvg+xml",
+  "application/vnd.yamaha.smaf-audio",
+  "application/vnd.yamaha.smaf-phrase",
+  "application/vnd.yellowriver-custom-menu",
+  "application/vnd.zul",
+  "application/vnd.zzazz.deck+xml",
+  "audio/adpcm",
+  "audio/basic",
+  "audio/midi",
+  "audio/mp4",
+  "audio/mpeg",
+  "audio/ogg",
+  "audio/s3m",
+  "audio/silk",
+  "audio/webm",
+  "audio/x-aac",
+  "audio/x-aiff",
+  "audio/x-caf",
+  "audio/x-flac",
+  "audio/x-matroska",
+  "audio/x-mpegurl",
+  "audio/x-ms-wax",
+  "audio/x-ms-wma",
+  "audio/x-pn-realaudio",
+  "audio/x-pn-realaudio-plugin",
+  "audio/x-wav",
+  "audio/xm",
+  "audio/vnd.dece.audio",
+  "audio/vnd.digital-winds",
+  "audio/vnd.dra",
+  "audio/vnd.dts",
+  "audio/vnd.dts.hd",
+  "audio/vnd.lucent.voice",
+  "audio/vnd.ms-playready.media.pya",
+  "audio/vnd.nuera.ecelp4800",
+  "audio/vnd.nuera.ecelp7470",
+  "audio/vnd.nuera.ecelp9600",
+  "audio/vnd.rip",
+  "chemical/x-cdx",
+  "chemical/x-cif",
+  "chemical/x-cmdf",
+  "chemical/x-cml",
+  "chemical/x-csml",
+  "chemical/x-xyz",
+  "font/collection",
+  "font/otf",
+  "font/ttf",
+  "font/woff",
+  "font/woff2",
+  "image/avif",
+  "image/bmp",
+  "image/cgm",
+  "image/g3fax",
+  "image/gif",
+  "image/ief",
+  "image/jpeg",
+  "image/jxl",
+  "image/ktx",
+  "image/png",
+  "image/sgi",
+  "image/svg+xml",
+  "image/tiff",
+  "image/webp",
+  "image/x-3ds",
+  "image/x-cmu-raster",
+  "image/x-cmx",
+  "image/x-freehand",
+  "image/x-icon",
+  "image/x-mrsid-image",
+  "image/x-pcx",
+  "image/x-pict",
+  "image/x-portable-anymap",
+  "image/x-portable-bitmap",
+  "image/x-portable-graymap",
+  "image/x-portable-pixmap",
+  "image/x-rgb",
+  "image/x-tga",
+  "image/x-xbitmap",
+  "image/x-xpixmap",
+  "image/x-xwindowdump",
+  "image/prs.btif",
+  "image/vnd.adobe.photoshop",
+  "image/vnd.dece.graphic",
+  "image/vnd.djvu",
+  "image/vnd.dvb.subtitle",
+  "image/vnd.dwg",
+  "image/vnd.dxf",
+  "image/vnd.fastbidsheet",
+  "image/vnd.fpx",
+  "image/vnd.fst",
+  "image/vnd.fujixerox.edmics-mmr",
+  "image/vnd.fujixerox.edmics-rlc",
+  "image/vnd.ms-modi",
+  "image/vnd.ms-photo",
+  "image/vnd.net-fpx",
+  "image/vnd.wap.wbmp",
+  "image/vnd.xiff",
+  "message/rfc822",
+  "model/iges",
+  "model/mesh",
+  "model/vrml",
+  "model/x3d+xml",
+  "model/x3d+binary",
+  "model/x3d+vrml",
+  "model/vnd.collada+xml",
+  "model/vnd.dwf",
+  "model/vnd.gdl",
+  "model/vnd.gtw",
+  "model/vnd.vtu",
+  "text/cache-manifest",
+  "text/calendar",
+  "text/css",
+  "text/csv",
+  "text/html",
+  "text/javascript",
+  "text/n3",
+  "text/plain",
+  "text/richtext",
+  "text/sgml",
+  "text/tab-separated-values",
+  "text/troff",
+  "text/turtle",
+  "text/uri-list",
+  "text/vcard",
+  "text/x-asm",
+  "text/x-c",
+  "text/x-fortran",
+  "text/x-java-source",
+  "text/x-nfo",
+  "text/x-opml",
+  "text/x-pascal",
+  "text/x-setext",
+  "text/x-sfv",
+  "text/x-uuencode",
+  "text/x-vcalendar",
+  "text/x-vcard",
+  "text/prs.lines.tag",
+  "text/vnd.curl",
+  "text/vnd.curl.dcurl",
+  "text/vnd.curl.mcurl",
+  "text/vnd.curl.scurl",
+  "text/vnd.dvb.subtitle",
+  "text/vnd.fly",
+  "text/vnd.fmi.flexstor",
+  "text/vnd.graphviz",
+  "text/vnd.in3d.3dml",
+  "text/vnd.in3d.spot",
+  "text/vnd.sun.j2me.app-descriptor",
+  "text/vnd.wap.wml",
+  "text/vnd.wap.wmlscript",
+  "video/3gpp",
+  "video/3gpp2",
+  "video/h261",
+  "video/h263",
+  "video/h264",
+  "video/jpeg",
+  "video/jpm",
+  "video/mj2",
+  "video/mp2t",
+  "video/mp4",
+  "video/mpeg",
+  "video/ogg",
+  "video/quicktime",
+  "video/webm",
+  "video/x-f4v",
+  "video/x-fli",
+  "video/x-flv",
+  "video/x-m4v",
+  "video/x-matroska",
+  "video/x-mng",
+  "video/x-ms-asf",
+  "video/x-ms-vob",
+  "video/x-ms-wm",
+  "video/x-ms-wmv",
+  "video/x-ms-wmx",
+  "video/x-ms-wvx",
+  "video/x-msvideo",
+  "video/x-sgi-movie",
+  "video/x-smv",
+  "video/vnd.dece.hd",
+  "video/vnd.dece.mobile",
+  "video/vnd.dece.pd",
+  "video/vnd.dece.sd",
+  "video/vnd.dece.video",
+  "video/vnd.dvb.file",
+  "video/vnd.fvt",
+  "video/vnd.mpegurl",
+  "video/vnd.ms-playready.media.pyv",
+  "video/vnd.uvvu.mp4",
+  "video/vnd.vivo",
+]
+
+internal let _internedMIMETypePathExtensions: [Set<MIMEType.PathExtension>] = [
+  [.ez],
+  [.aw],
+  [.atom],
+  [.atomcat],
+  [.atomsvc],
+  [.ccxml],
+  [.cdmia],
+  [.cdmic],
+  [.cdmid],
+  [.cdmio],
+  [.cdmiq],
+  [.cu],
+  [.davmount],
+  [.dbk],
+  [.dssc],
+  [.xdssc],
+  [.ecma],
+  [.emma],
+  [.epub],
+  [.exi],
+  [.pfr],
+  [.gml],
+  [.gpx],
+  [.gxf],
+  [.stk],
+  [.ink, .inkml],
+  [.ipfix],
+  [.jar],
+  [.ser],
+  [.`class`],
+  [.json],
+  [.jsonml],
+  [.lostxml],
+  [.hqx],
+  [.cpt],
+  [.mads],
+  [.mrc],
+  [.mrcx],
+  [.ma, .mb, .nb],
+  [.mathml],
+  [.mbox],
+  [.mscml],
+  [.metalink],
+  [.meta4],
+  [.mets],
+  [.mods],
+  [.m21, .mp21],
+  [.mp4s],
+  [.doc, .dot],
+  [.mxf],
+  [.bin, .bpk, .deploy, .dist, .distz, .dms, .dump, .elc, .lrf, .mar, .pkg, .so],
+  [.oda],
+  [.opf],
+  [.ogx],
+  [.omdoc],
+  [.onepkg, .onetmp, .onetoc, .onetoc2],
+  [.oxps],
+  [.xer],
+  [.pdf],
+  [.pgp],
+  [.asc, .sig],
+  [.prf],
+  [.p10],
+  [.p7c, .p7m],
+  [.p7s],
+  [.p8],
+  [.ac],
+  [.cer],
+  [.crl],
+  [.pkipath],
+  [.pki],
+  [.pls],
+  [.ai, .eps, .ps],
+  [.pskcxml],
+  [.rdf],
+  [.rif],
+  [.rnc],
+  [.rl],
+  [.rld],
+  [.rs],
+  [.gbr],
+  [.mft],
+  [.roa],
+  [.rsd],
+  [.rss],
+  [.rtf],
+  [.sbml],
+  [.scq],
+  [.scs],
+  [.spq],
+  [.spp],
+  [.sdp],
+  [.setpay],
+  [.setreg],
+  [.shf],
+  [.smi, .smil],
+  [.rq],
+  [.srx],
+  [.gram],
+  [.grxml],
+  [.sru],
+  [.ssdl],
+  [.ssml],
+  [.tei, .teicorpus],
+  [.tfi],
+  [.tsd],
+  [.vxml],
+  [.wasm],
+  [.wgt],
+  [.hlp],
+  [.wsdl],
+  [.wspolicy],
+  [._7z],
+  [.abw],
+  [.ace],
+  [.dmg],
+  [.aab, .u32, .vox, .x32],
+  [.aam],
+  [.aas],
+  [.bcpio],
+  [.torrent],
+  [.blb, .blorb],
+  [.bz],
+  [.boz, .bz2],
+  [.cb7, .cba, .cbr, .cbt, .cbz],
+  [.vcd],
+  [.cfs],
+  [.chat],
+  [.pgn],
+  [.nsc],
+  [.cpio],
+  [.csh],
+  [.deb, .udeb],
+  [.dgc],
+  [.cct, .cst, .cxt, .dcr, .dir, .dxr, .fgd, .swa, .w3d],
+  [.wad],
+  [.ncx],
+  [.dtb],
+  [.res],
+  [.dvi],
+  [.evy],
+  [.eva],
+  [.bdf],
+  [.gsf],
+  [.psf],
+  [.pcf],
+  [.snf],
+  [.afm, .pfa, .pfb, .pfm],
+  [.arc],
+  [.spl],
+  [.gca],
+  [.ulx],
+  [.gnumeric],
+  [.gramps],
+  [.gtar],
+  [.hdf],
+  [.install],
+  [.iso],
+  [.jnlp],
+  [.latex],
+  [.lha, .lzh],
+  [.mie],
+  [.mobi, .prc],
+  [.application],
+  [.lnk],
+  [.wmd],
+  [.wmz],
+  [.xbap],
+  [.mdb],
+  [.obd],
+  [.crd],
+  [.clp],
+  [.bat, .com, .dll, .exe, .msi],
+  [.m13, .m14, .mvb],
+  [.emf, .emz, .wmf, .wmz],
+  [.mny],
+  [.pub],
+  [.scd],
+  [.trm],
+  [.wri],
+  [.cdf, .nc],
+  [.nzb],
+  [.p12, .pfx],
+  [.p7b, .spc],
+  [.p7r],
+  [.rar],
+  [.ris],
+  [.sh],
+  [.shar],
+  [.swf],
+  [.xap],
+  [.sql],
+  [.sit],
+  [.sitx],
+  [.srt],
+  [.sv4cpio],
+  [.sv4crc],
+  [.t3],
+  [.gam],
+  [.tar],
+  [.tcl],
+  [.tex],
+  [.tfm],
+  [.texi, .texinfo],
+  [.obj],
+  [.ustar],
+  [.src],
+  [.crt, .der],
+  [.fig],
+  [.xlf],
+  [.xpi],
+  [.xz],
+  [.z1, .z2, .z3, .z4, .z5, .z6, .z7, .z8],
+  [.xaml],
+  [.xdf],
+  [.xenc],
+  [.xht, .xhtml],
+  [.xml, .xsl],
+  [.dtd],
+  [.xop],
+  [.xpl],
+  [.xslt],
+  [.xspf],
+  [.mxml, .xhvml, .xvm, .xvml],
+  [.yang],
+  [.yin],
+  [.zip],
+  [.cww],
+  [.plb],
+  [.psb],
+  [.pvb],
+  [.tcap],
+  [.pwn],
+  [.aso],
+  [.imp],
+  [.acu],
+  [.acutc, .atc],
+  [.air],
+  [.fcdt],
+  [.fxp, .fxpl],
+  [.xdp],
+  [.xfdf],
+  [.ahead],
+  [.azf],
+  [.azs],
+  [.azw],
+  [.acc],
+  [.ami],
+  [.apk],
+  [.cii],
+  [.fti],
+  [.atx],
+  [.mpkg],
+  [.m3u8],
+  [.swi],
+  [.iota],
+  [.aep],
+  [.mpm],
+  [.bmi],
+  [.rep],
+  [.cdxml],
+  [.mmd],
+  [.cdy],
+  [.cla],
+  [.rp9],
+  [.c4d, .c4f, .c4g, .c4p, .c4u],
+  [.c11amc],
+  [.c11amz],
+  [.csp],
+  [.cdbcmsg],
+  [.cmc],
+  [.clkx],
+  [.clkk],
+  [.clkp],
+  [.clkt],
+  [.clkw],
+  [.wbs],
+  [.pml],
+  [.ppd],
+  [.car],
+  [.pcurl],
+  [.dart],
+  [.rdz],
+  [.uvd, .uvf, .uvvd, .uvvf],
+  [.uvt, .uvvt],
+  [.uvvx, .uvx],
+  [.uvvz, .uvz],
+  [.feLaunch],
+  [.dna],
+  [.mlp],
+  [.dpg],
+  [.dfac],
+  [.kpxx],
+  [.ait],
+  [.svc],
+  [.geo],
+  [.mag],
+  [.nml],
+  [.esf],
+  [.msf],
+  [.qam],
+  [.slt],
+  [.ssf],
+  [.es3, .et3],
+  [.ez2],
+  [.ez3],
+  [.fdf],
+  [.mseed],
+  [.dataless, .seed],
+  [.gph],
+  [.ftc],
+  [.book, .fm, .frame, .maker],
+  [.fnc],
+  [.ltf],
+  [.fsc],
+  [.oas],
+  [.oa2],
+  [.oa3],
+  [.fg5],
+  [.bh2],
+  [.ddd],
+  [.xdw],
+  [.xbd],
+  [.fzs],
+  [.txd],
+  [.ggb],
+  [.ggs],
+  [.ggt],
+  [.gex, .gre],
+  [.gxt],
+  [.g2w],
+  [.g3w],
+  [.gmx],
+  [.kml],
+  [.kmz],
+  [.gqf, .gqs],
+  [.gac],
+  [.ghf],
+  [.gim],
+  [.grv],
+  [.gtm],
+  [.tpl],
+  [.vcg],
+  [.hal],
+  [.zmm],
+  [.hbci],
+  [.les],
+  [.hpgl],
+  [.hpid],
+  [.hps],
+  [.jlt],
+  [.pcl],
+  [.pclxl],
+  [.sfdHdstx],
+  [.mpy],
+  [.afp, .list3820, .listafp],
+  [.irm],
+  [.sc],
+  [.icc, .icm],
+  [.igl],
+  [.ivp],
+  [.ivu],
+  [.igm],
+  [.xpw, .xpx],
+  [.i2g],
+  [.qbo],
+  [.qfx],
+  [.rcprofile],
+  [.irp],
+  [.xpr],
+  [.fcs],
+  [.jam],
+  [.rms],
+  [.jisp],
+  [.joda],
+  [.ktr, .ktz],
+  [.karbon],
+  [.chrt],
+  [.kfo],
+  [.flw],
+  [.kon],
+  [.kpr, .kpt],
+  [.ksp],
+  [.kwd, .kwt],
+  [.htke],
+  [.kia],
+  [.kne, .knp],
+  [.skd, .skm, .skp, .skt],
+  [.sse],
+  [.lasxml],
+  [.lbd],
+  [.lbe],
+  [._123],
+  [.apr],
+  [.pre],
+  [.nsf],
+  [.org],
+  [.scm],
+  [.lwp],
+  [.portpkg],
+  [.mcd],
+  [.mc1],
+  [.cdkey],
+  [.mwf],
+  [.mfm],
+  [.flo],
+  [.igx],
+  [.mif],
+  [.daf],
+  [.dis],
+  [.mbk],
+  [.mqy],
+  [.msl],
+  [.plc],
+  [.txf],
+  [.mpn],
+  [.mpc],
+  [.xul],
+  [.cil],
+  [.cab],
+  [.xla, .xlc, .xlm, .xls, .xlt, .xlw],
+  [.xlam],
+  [.xlsb],
+  [.xlsm],
+  [.xltm],
+  [.eot],
+  [.chm],
+  [.ims],
+  [.lrm],
+  [.thmx],
+  [.cat],
+  [.stl],
+  [.pot, .pps, .ppt],
+  [.ppam],
+  [.pptm],
+  [.sldm],
+  [.ppsm],
+  [.potm],
+  [.mpp, .mpt],
+  [.docm],
+  [.dotm],
+  [.wcm, .wdb, .wks, .wps],
+  [.wpl],
+  [.xps],
+  [.mseq],
+  [.mus],
+  [.msty],
+  [.taglet],
+  [.nlu],
+  [.nitf, .ntf],
+  [.nnd],
+  [.nns],
+  [.nnw],
+  [.ngdat],
+  [.nGage],
+  [.rpst],
+  [.rpss],
+  [.edm],
+  [.edx],
+  [.ext],
+  [.odc],
+  [.otc],
+  [.odb],
+  [.odf],
+  [.odft],
+  [.odg],
+  [.otg],
+  [.odi],
+  [.oti],
+  [.odp],
+  [.otp],
+  [.ods],
+  [.ots],
+  [.odt],
+  [.odm],
+  [.ott],
+  [.oth],
+  [.xo],
+  [.dd2],
+  [.oxt],
+  [.pptx],
+  [.sldx],
+  [.ppsx],
+  [.potx],
+  [.xlsx],
+  [.xltx],
+  [.docx],
+  [.dotx],
+  [.mgp],
+  [.dp],
+  [.esa],
+  [.oprc, .pdb, .pqa],
+  [.paw],
+  [.str],
+  [.ei6],
+  [.efif],
+  [.wg],
+  [.plf],
+  [.pbd],
+  [.box],
+  [.mgz],
+  [.qps],
+  [.ptid],
+  [.qwd, .qwt, .qxb, .qxd, .qxl, .qxt],
+  [.bed],
+  [.mxl],
+  [.musicxml],
+  [.cryptonote],
+  [.cod],
+  [.rm],
+  [.rmvb],
+  [.link66],
+  [.st],
+  [.see],
+  [.sema],
+  [.semd],
+  [.semf],
+  [.ifm],
+  [.itp],
+  [.iif],
+  [.ipk],
+  [.twd, .twds],
+  [.mmf],
+  [.teacher],
+  [.sdkd, .sdkm],
+  [.dxp],
+  [.sfs],
+  [.sdc],
+  [.sda],
+  [.sdd],
+  [.smf],
+  [.sdw, .vor],
+  [.sgl],
+  [.smzip],
+  [.sm],
+  [.sxc],
+  [.stc],
+  [.sxd],
+  [.std],
+  [.sxi],
+  [.sti],
+  [.sxm],
+  [.sxw],
+  [.sxg],
+  [.stw],
+  [.sus, .susp],
+  [.svd],
+  [.sis, .sisx],
+  [.xsm],
+  [.bdm],
+  [.xdm],
+  [.tao],
+  [.cap, .dmp, .pcap],
+  [.tmo],
+  [.tpt],
+  [.mxs],
+  [.tra],
+  [.ufd, .ufdl],
+  [.utz],
+  [.umj],
+  [.unityweb],
+  [.uoml],
+  [.vcx],
+  [.vsd, .vss, .vst, .vsw],
+  [.vis],
+  [.vsf],
+  [.wbxml],
+  [.wmlc],
+  [.wmlsc],
+  [.wtb],
+  [.nbp],
+  [.wpd],
+  [.wqd],
+  [.stf],
+  [.xar],
+  [.xfdl],
+  [.hvd],
+  [.hvs],
+  [.hvp],
+  [.osf],
+  [.osfpvg],
+  [.saf],
+  [.spf],
+  [.cmp],
+  [.zir, .zirz],
+  [.zaz],
+  [.adp],
+  [.au, .snd],
+  [.kar, .mid, .midi, .rmi],
+  [.m4a, .mp4a],
+  [.m2a, .m3a, .mp2, .mp2a, .mp3, .mpga],
+  [.oga, .ogg, .opus, .spx],
+  [.s3m],
+  [.sil],
+  [.weba],
+  [.aac],
+  [.aif, .aifc, .aiff],
+  [.caf],
+  [.flac],
+  [.mka],
+  [.m3u],
+  [.wax],
+  [.wma],
+  [.ra, .ram],
+  [.rmp],
+  [.wav],
+  [.xm],
+  [.uva, .uvva],
+  [.eol],
+  [.dra],
+  [.dts],
+  [.dtshd],
+  [.lvp],
+  [.pya],
+  [.ecelp4800],
+  [.ecelp7470],
+  [.ecelp9600],
+  [.rip],
+  [.cdx],
+  [.cif],
+  [.cmdf],
+  [.cml],
+  [.csml],
+  [.xyz],
+  [.ttc],
+  [.otf],
+  [.ttf],
+  [.woff],
+  [.woff2],
+  [.avif],
+  [.bmp],
+  [.cgm],
+  [.g3],
+  [.gif],
+  [.ief],
+  [.jpe, .jpeg, .jpg],
+  [.jxl],
+  [.ktx],
+  [.png],
+  [.sgi],
+  [.svg, .svgz],
+  [.tif, .tiff],
+  [.webp],
+  [._3ds],
+  [.ras],
+  [.cmx],
+  [.fh, .fh4, .fh5, .fh7, .fhc],
+  [.ico],
+  [.sid],
+  [.pcx],
+  [.pct, .pic],
+  [.pnm],
+  [.pbm],
+  [.pgm],
+  [.ppm],
+  [.rgb],
+  [.tga],
+  [.xbm],
+  [.xpm],
+  [.xwd],
+  [.btif],
+  [.psd],
+  [.uvg, .uvi, .uvvg, .uvvi],
+  [.djv, .djvu],
+  [.sub],
+  [.dwg],
+  [.dxf],
+  [.fbs],
+  [.fpx],
+  [.fst],
+  [.mmr],
+  [.rlc],
+  [.mdi],
+  [.wdp],
+  [.npx],
+  [.wbmp],
+  [.xif],
+  [.eml, .mime],
+  [.iges, .igs],
+  [.mesh, .msh, .silo],
+  [.vrml, .wrl],
+  [.x3d, .x3dz],
+  [.x3db, .x3dbz],
+  [.x3dv, .x3dvz],
+  [.dae],
+  [.dwf],
+  [.gdl],
+  [.gtw],
+  [.vtu],
+  [.appcache],
+  [.ics, .ifb],
+  [.css],
+  [.csv],
+  [.htm, .html],
+  [.js, .mjs],
+  [.n3],
+  [.conf, .def, .`in`, .list, .log, .text, .txt],
+  [.rtx],
+  [.sgm, .sgml],
+  [.tsv],
+  [.man, .me, .ms, .roff, .t, .tr],
+  [.ttl],
+  [.uri, .uris, .urls],
+  [.vcard],
+  [.asm, .s],
+  [.c, .cc, .cpp, .cxx, .dic, .h, .hh],
+  [.f, .f77, .f90, .`for`],
+  [.java],
+  [.nfo],
+  [.opml],
+  [.p, .pas],
+  [.etx],
+  [.sfv],
+  [.uu],
+  [.vcs],
+  [.vcf],
+  [.dsc],
+  [.curl],
+  [.dcurl],
+  [.mcurl],
+  [.scurl],
+  [.sub],
+  [.fly],
+  [.flx],
+  [.gv],
+  [._3dml],
+  [.spot],
+  [.jad],
+  [.wml],
+  [.wmls],
+  [._3gp],
+  [._3g2],
+  [.h261],
+  [.h263],
+  [.h264],
+  [.jpgv],
+  [.jpgm, .jpm],
+  [.mj2, .mjp2],
+  [.m2t, .m2ts, .mts, .ts],
+  [.mp4, .mp4v, .mpg4],
+  [.m1v, .m2v, .mpe, .mpeg, .mpg],
+  [.ogv],
+  [.mov, .qt],
+  [.webm],
+  [.f4v],
+  [.fli],
+  [.flv],
+  [.m4v],
+  [.mk3d, .mks, .mkv],
+  [.mng],
+  [.asf, .asx],
+  [.vob],
+  [.wm],
+  [.wmv],
+  [.wmx],
+  [.wvx],
+  [.avi],
+  [.movie],
+  [.smv],
+  [.uvh, .uvvh],
+  [.uvm, .uvvm],
+  [.uvp, .uvvp],
+  [.uvs, .uvvs],
+  [.uvv, .uvvv],
+  [.dvb],
+  [.fvt],
+  [.m4u, .mxu],
+  [.pyv],
+  [.uvu, .uvvu],
+  [.viv],
 ]
-internal let _ext_to_mimeType: [MIMEType.PathExtension: MIMEType._Core] = [
-  ._123: MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-1-2-3", suffix: nil),
-  ._3dml: MIMEType._Core(type: .text, tree: .vnd, subtype: "in3d.3dml", suffix: nil),
-  ._3ds: MIMEType._Core(type: .image, tree: nil, subtype: "x-3ds", suffix: nil),
-  ._3g2: MIMEType._Core(type: .video, tree: nil, subtype: "3gpp2", suffix: nil),
-  ._3gp: MIMEType._Core(type: .video, tree: nil, subtype: "3gpp", suffix: nil),
-  ._7z: MIMEType._Core(type: .application, tree: nil, subtype: "x-7z-compressed", suffix: nil),
-  .aab: MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-bin", suffix: nil),
-  .aac: MIMEType._Core(type: .audio, tree: nil, subtype: "x-aac", suffix: nil),
-  .aam: MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-map", suffix: nil),
-  .aas: MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-seg", suffix: nil),
-  .abw: MIMEType._Core(type: .application, tree: nil, subtype: "x-abiword", suffix: nil),
-  .ac: MIMEType._Core(type: .application, tree: nil, subtype: "pkix-attr-cert", suffix: nil),
-  .acc: MIMEType._Core(type: .application, tree: .vnd, subtype: "americandynamics.acc", suffix: nil),
-  .ace: MIMEType._Core(type: .application, tree: nil, subtype: "x-ace-compressed", suffix: nil),
-  .acu: MIMEType._Core(type: .application, tree: .vnd, subtype: "acucobol", suffix: nil),
-  .acutc: MIMEType._Core(type: .application, tree: .vnd, subtype: "acucorp", suffix: nil),
-  .adp: MIMEType._Core(type: .audio, tree: nil, subtype: "adpcm", suffix: nil),
-  .aep: MIMEType._Core(type: .application, tree: .vnd, subtype: "audiograph", suffix: nil),
-  .afm: MIMEType._Core(type: .application, tree: nil, subtype: "x-font-type1", suffix: nil),
-  .afp: MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.modcap", suffix: nil),
-  .ahead: MIMEType._Core(type: .application, tree: .vnd, subtype: "ahead.space", suffix: nil),
-  .ai: MIMEType._Core(type: .application, tree: nil, subtype: "postscript", suffix: nil),
-  .aif: MIMEType._Core(type: .audio, tree: nil, subtype: "x-aiff", suffix: nil),
-  .aifc: MIMEType._Core(type: .audio, tree: nil, subtype: "x-aiff", suffix: nil),
-  .aiff: MIMEType._Core(type: .audio, tree: nil, subtype: "x-aiff", suffix: nil),
-  .air: MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.air-application-installer-package", suffix: .zip),
-  .ait: MIMEType._Core(type: .application, tree: .vnd, subtype: "dvb.ait", suffix: nil),
-  .ami: MIMEType._Core(type: .application, tree: .vnd, subtype: "amiga.ami", suffix: nil),
-  .apk: MIMEType._Core(type: .application, tree: .vnd, subtype: "android.package-archive", suffix: nil),
-  .appcache: MIMEType._Core(type: .text, tree: nil, subtype: "cache-manifest", suffix: nil),
-  .application: MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-application", suffix: nil),
-  .apr: MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-approach", suffix: nil),
-  .arc: MIMEType._Core(type: .application, tree: nil, subtype: "x-freearc", suffix: nil),
-  .asc: MIMEType._Core(type: .application, tree: nil, subtype: "pgp-signature", suffix: nil),
-  .asf: MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-asf", suffix: nil),
-  .asm: MIMEType._Core(type: .text, tree: nil, subtype: "x-asm", suffix: nil),
-  .aso: MIMEType._Core(type: .application, tree: .vnd, subtype: "accpac.simply.aso", suffix: nil),
-  .asx: MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-asf", suffix: nil),
-  .atc: MIMEType._Core(type: .application, tree: .vnd, subtype: "acucorp", suffix: nil),
-  .atom: MIMEType._Core(type: .application, tree: nil, subtype: "atom", suffix: .xml),
-  .atomcat: MIMEType._Core(type: .application, tree: nil, subtype: "atomcat", suffix: .xml),
-  .atomsvc: MIMEType._Core(type: .application, tree: nil, subtype: "atomsvc", suffix: .xml),
-  .atx: MIMEType._Core(type: .application, tree: .vnd, subtype: "antix.game-component", suffix: nil),
-  .au: MIMEType._Core(type: .audio, tree: nil, subtype: "basic", suffix: nil),
-  .avi: MIMEType._Core(type: .video, tree: nil, subtype: "x-msvideo", suffix: nil),
-  .avif: MIMEType._Core(type: .image, tree: nil, subtype: "avif", suffix: nil),
-  .aw: MIMEType._Core(type: .application, tree: nil, subtype: "applixware", suffix: nil),
-  .azf: MIMEType._Core(type: .application, tree: .vnd, subtype: "airzip.filesecure.azf", suffix: nil),
-  .azs: MIMEType._Core(type: .application, tree: .vnd, subtype: "airzip.filesecure.azs", suffix: nil),
-  .azw: MIMEType._Core(type: .application, tree: .vnd, subtype: "amazon.ebook", suffix: nil),
-  .bat: MIMEType._Core(type: .application, tree: nil, subtype: "x-msdownload", suffix: nil),
-  .bcpio: MIMEType._Core(type: .application, tree: nil, subtype: "x-bcpio", suffix: nil),
-  .bdf: MIMEType._Core(type: .application, tree: nil, subtype: "x-font-bdf", suffix: nil),
-  .bdm: MIMEType._Core(type: .application, tree: .vnd, subtype: "syncml.dm", suffix: .wbxml),
-  .bed: MIMEType._Core(type: .application, tree: .vnd, subtype: "realvnc.bed", suffix: nil),
-  .bh2: MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasysprs", suffix: nil),
-  .bin: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .blb: MIMEType._Core(type: .application, tree: nil, subtype: "x-blorb", suffix: nil),
-  .blorb: MIMEType._Core(type: .application, tree: nil, subtype: "x-blorb", suffix: nil),
-  .bmi: MIMEType._Core(type: .application, tree: .vnd, subtype: "bmi", suffix: nil),
-  .bmp: MIMEType._Core(type: .image, tree: nil, subtype: "bmp", suffix: nil),
-  .book: MIMEType._Core(type: .application, tree: .vnd, subtype: "framemaker", suffix: nil),
-  .box: MIMEType._Core(type: .application, tree: .vnd, subtype: "previewsystems.box", suffix: nil),
-  .boz: MIMEType._Core(type: .application, tree: nil, subtype: "x-bzip2", suffix: nil),
-  .bpk: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .btif: MIMEType._Core(type: .image, tree: .prs, subtype: "btif", suffix: nil),
-  .bz: MIMEType._Core(type: .application, tree: nil, subtype: "x-bzip", suffix: nil),
-  .bz2: MIMEType._Core(type: .application, tree: nil, subtype: "x-bzip2", suffix: nil),
-  .c: MIMEType._Core(type: .text, tree: nil, subtype: "x-c", suffix: nil),
-  .c11amc: MIMEType._Core(type: .application, tree: .vnd, subtype: "cluetrust.cartomobile-config", suffix: nil),
-  .c11amz: MIMEType._Core(type: .application, tree: .vnd, subtype: "cluetrust.cartomobile-config-pkg", suffix: nil),
-  .c4d: MIMEType._Core(type: .application, tree: .vnd, subtype: "clonk.c4group", suffix: nil),
-  .c4f: MIMEType._Core(type: .application, tree: .vnd, subtype: "clonk.c4group", suffix: nil),
-  .c4g: MIMEType._Core(type: .application, tree: .vnd, subtype: "clonk.c4group", suffix: nil),
-  .c4p: MIMEType._Core(type: .application, tree: .vnd, subtype: "clonk.c4group", suffix: nil),
-  .c4u: MIMEType._Core(type: .application, tree: .vnd, subtype: "clonk.c4group", suffix: nil),
-  .cab: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-cab-compressed", suffix: nil),
-  .caf: MIMEType._Core(type: .audio, tree: nil, subtype: "x-caf", suffix: nil),
-  .cap: MIMEType._Core(type: .application, tree: .vnd, subtype: "tcpdump.pcap", suffix: nil),
-  .car: MIMEType._Core(type: .application, tree: .vnd, subtype: "curl.car", suffix: nil),
-  .cat: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-pki.seccat", suffix: nil),
-  .cb7: MIMEType._Core(type: .application, tree: nil, subtype: "x-cbr", suffix: nil),
-  .cba: MIMEType._Core(type: .application, tree: nil, subtype: "x-cbr", suffix: nil),
-  .cbr: MIMEType._Core(type: .application, tree: nil, subtype: "x-cbr", suffix: nil),
-  .cbt: MIMEType._Core(type: .application, tree: nil, subtype: "x-cbr", suffix: nil),
-  .cbz: MIMEType._Core(type: .application, tree: nil, subtype: "x-cbr", suffix: nil),
-  .cc: MIMEType._Core(type: .text, tree: nil, subtype: "x-c", suffix: nil),
-  .cct: MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
-  .ccxml: MIMEType._Core(type: .application, tree: nil, subtype: "ccxml", suffix: .xml),
-  .cdbcmsg: MIMEType._Core(type: .application, tree: .vnd, subtype: "contact.cmsg", suffix: nil),
-  .cdf: MIMEType._Core(type: .application, tree: nil, subtype: "x-netcdf", suffix: nil),
-  .cdkey: MIMEType._Core(type: .application, tree: .vnd, subtype: "mediastation.cdkey", suffix: nil),
-  .cdmia: MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-capability", suffix: nil),
-  .cdmic: MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-container", suffix: nil),
-  .cdmid: MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-domain", suffix: nil),
-  .cdmio: MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-object", suffix: nil),
-  .cdmiq: MIMEType._Core(type: .application, tree: nil, subtype: "cdmi-queue", suffix: nil),
-  .cdx: MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cdx", suffix: nil),
-  .cdxml: MIMEType._Core(type: .application, tree: .vnd, subtype: "chemdraw", suffix: .xml),
-  .cdy: MIMEType._Core(type: .application, tree: .vnd, subtype: "cinderella", suffix: nil),
-  .cer: MIMEType._Core(type: .application, tree: nil, subtype: "pkix-cert", suffix: nil),
-  .cfs: MIMEType._Core(type: .application, tree: nil, subtype: "x-cfs-compressed", suffix: nil),
-  .cgm: MIMEType._Core(type: .image, tree: nil, subtype: "cgm", suffix: nil),
-  .chat: MIMEType._Core(type: .application, tree: nil, subtype: "x-chat", suffix: nil),
-  .chm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-htmlhelp", suffix: nil),
-  .chrt: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kchart", suffix: nil),
-  .cif: MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cif", suffix: nil),
-  .cii: MIMEType._Core(type: .application, tree: .vnd, subtype: "anser-web-certificate-issue-initiation", suffix: nil),
-  .cil: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-artgalry", suffix: nil),
-  .cla: MIMEType._Core(type: .application, tree: .vnd, subtype: "claymore", suffix: nil),
-  .`class`: MIMEType._Core(type: .application, tree: nil, subtype: "java-vm", suffix: nil),
-  .clkk: MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.keyboard", suffix: nil),
-  .clkp: MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.palette", suffix: nil),
-  .clkt: MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.template", suffix: nil),
-  .clkw: MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker.wordbank", suffix: nil),
-  .clkx: MIMEType._Core(type: .application, tree: .vnd, subtype: "crick.clicker", suffix: nil),
-  .clp: MIMEType._Core(type: .application, tree: nil, subtype: "x-msclip", suffix: nil),
-  .cmc: MIMEType._Core(type: .application, tree: .vnd, subtype: "cosmocaller", suffix: nil),
-  .cmdf: MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cmdf", suffix: nil),
-  .cml: MIMEType._Core(type: .chemical, tree: nil, subtype: "x-cml", suffix: nil),
-  .cmp: MIMEType._Core(type: .application, tree: .vnd, subtype: "yellowriver-custom-menu", suffix: nil),
-  .cmx: MIMEType._Core(type: .image, tree: nil, subtype: "x-cmx", suffix: nil),
-  .cod: MIMEType._Core(type: .application, tree: .vnd, subtype: "rim.cod", suffix: nil),
-  .com: MIMEType._Core(type: .application, tree: nil, subtype: "x-msdownload", suffix: nil),
-  .conf: MIMEType._Core(type: .text, tree: nil, subtype: "plain", suffix: nil),
-  .cpio: MIMEType._Core(type: .application, tree: nil, subtype: "x-cpio", suffix: nil),
-  .cpp: MIMEType._Core(type: .text, tree: nil, subtype: "x-c", suffix: nil),
-  .cpt: MIMEType._Core(type: .application, tree: nil, subtype: "mac-compactpro", suffix: nil),
-  .crd: MIMEType._Core(type: .application, tree: nil, subtype: "x-mscardfile", suffix: nil),
-  .crl: MIMEType._Core(type: .application, tree: nil, subtype: "pkix-crl", suffix: nil),
-  .crt: MIMEType._Core(type: .application, tree: nil, subtype: "x-x509-ca-cert", suffix: nil),
-  .cryptonote: MIMEType._Core(type: .application, tree: .vnd, subtype: "rig.cryptonote", suffix: nil),
-  .csh: MIMEType._Core(type: .application, tree: nil, subtype: "x-csh", suffix: nil),
-  .csml: MIMEType._Core(type: .chemical, tree: nil, subtype: "x-csml", suffix: nil),
-  .csp: MIMEType._Core(type: .application, tree: .vnd, subtype: "commonspace", suffix: nil),
-  .css: MIMEType._Core(type: .text, tree: nil, subtype: "css", suffix: nil),
-  .cst: MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
-  .csv: MIMEType._Core(type: .text, tree: nil, subtype: "csv", suffix: nil),
-  .cu: MIMEType._Core(type: .application, tree: nil, subtype: "cu-seeme", suffix: nil),
-  .curl: MIMEType._Core(type: .text, tree: .vnd, subtype: "curl", suffix: nil),
-  .cww: MIMEType._Core(type: .application, tree: .prs, subtype: "cww", suffix: nil),
-  .cxt: MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
-  .cxx: MIMEType._Core(type: .text, tree: nil, subtype: "x-c", suffix: nil),
-  .dae: MIMEType._Core(type: .model, tree: .vnd, subtype: "collada", suffix: .xml),
-  .daf: MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.daf", suffix: nil),
-  .dart: MIMEType._Core(type: .application, tree: .vnd, subtype: "dart", suffix: nil),
-  .dataless: MIMEType._Core(type: .application, tree: .vnd, subtype: "fdsn.seed", suffix: nil),
-  .davmount: MIMEType._Core(type: .application, tree: nil, subtype: "davmount", suffix: .xml),
-  .dbk: MIMEType._Core(type: .application, tree: nil, subtype: "docbook", suffix: .xml),
-  .dcr: MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
-  .dcurl: MIMEType._Core(type: .text, tree: .vnd, subtype: "curl.dcurl", suffix: nil),
-  .dd2: MIMEType._Core(type: .application, tree: .vnd, subtype: "oma.dd2", suffix: .xml),
-  .ddd: MIMEType._Core(type: .application, tree: .vnd, subtype: "fujixerox.ddd", suffix: nil),
-  .deb: MIMEType._Core(type: .application, tree: nil, subtype: "x-debian-package", suffix: nil),
-  .def: MIMEType._Core(type: .text, tree: nil, subtype: "plain", suffix: nil),
-  .deploy: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .der: MIMEType._Core(type: .application, tree: nil, subtype: "x-x509-ca-cert", suffix: nil),
-  .dfac: MIMEType._Core(type: .application, tree: .vnd, subtype: "dreamfactory", suffix: nil),
-  .dgc: MIMEType._Core(type: .application, tree: nil, subtype: "x-dgc-compressed", suffix: nil),
-  .dic: MIMEType._Core(type: .text, tree: nil, subtype: "x-c", suffix: nil),
-  .dir: MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
-  .dis: MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.dis", suffix: nil),
-  .dist: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .distz: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .djv: MIMEType._Core(type: .image, tree: .vnd, subtype: "djvu", suffix: nil),
-  .djvu: MIMEType._Core(type: .image, tree: .vnd, subtype: "djvu", suffix: nil),
-  .dll: MIMEType._Core(type: .application, tree: nil, subtype: "x-msdownload", suffix: nil),
-  .dmg: MIMEType._Core(type: .application, tree: nil, subtype: "x-apple-diskimage", suffix: nil),
-  .dmp: MIMEType._Core(type: .application, tree: .vnd, subtype: "tcpdump.pcap", suffix: nil),
-  .dms: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .dna: MIMEType._Core(type: .application, tree: .vnd, subtype: "dna", suffix: nil),
-  .doc: MIMEType._Core(type: .application, tree: nil, subtype: "msword", suffix: nil),
-  .docm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-word.document.macroenabled.12", suffix: nil),
-  .docx: MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.wordprocessingml.document", suffix: nil),
-  .dot: MIMEType._Core(type: .application, tree: nil, subtype: "msword", suffix: nil),
-  .dotm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-word.template.macroenabled.12", suffix: nil),
-  .dotx: MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.wordprocessingml.template", suffix: nil),
-  .dp: MIMEType._Core(type: .application, tree: .vnd, subtype: "osgi.dp", suffix: nil),
-  .dpg: MIMEType._Core(type: .application, tree: .vnd, subtype: "dpgraph", suffix: nil),
-  .dra: MIMEType._Core(type: .audio, tree: .vnd, subtype: "dra", suffix: nil),
-  .dsc: MIMEType._Core(type: .text, tree: .prs, subtype: "lines.tag", suffix: nil),
-  .dssc: MIMEType._Core(type: .application, tree: nil, subtype: "dssc", suffix: .der),
-  .dtb: MIMEType._Core(type: .application, tree: nil, subtype: "x-dtbook", suffix: .xml),
-  .dtd: MIMEType._Core(type: .application, tree: nil, subtype: "xml-dtd", suffix: nil),
-  .dts: MIMEType._Core(type: .audio, tree: .vnd, subtype: "dts", suffix: nil),
-  .dtshd: MIMEType._Core(type: .audio, tree: .vnd, subtype: "dts.hd", suffix: nil),
-  .dump: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .dvb: MIMEType._Core(type: .video, tree: .vnd, subtype: "dvb.file", suffix: nil),
-  .dvi: MIMEType._Core(type: .application, tree: nil, subtype: "x-dvi", suffix: nil),
-  .dwf: MIMEType._Core(type: .model, tree: .vnd, subtype: "dwf", suffix: nil),
-  .dwg: MIMEType._Core(type: .image, tree: .vnd, subtype: "dwg", suffix: nil),
-  .dxf: MIMEType._Core(type: .image, tree: .vnd, subtype: "dxf", suffix: nil),
-  .dxp: MIMEType._Core(type: .application, tree: .vnd, subtype: "spotfire.dxp", suffix: nil),
-  .dxr: MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
-  .ecelp4800: MIMEType._Core(type: .audio, tree: .vnd, subtype: "nuera.ecelp4800", suffix: nil),
-  .ecelp7470: MIMEType._Core(type: .audio, tree: .vnd, subtype: "nuera.ecelp7470", suffix: nil),
-  .ecelp9600: MIMEType._Core(type: .audio, tree: .vnd, subtype: "nuera.ecelp9600", suffix: nil),
-  .ecma: MIMEType._Core(type: .application, tree: nil, subtype: "ecmascript", suffix: nil),
-  .edm: MIMEType._Core(type: .application, tree: .vnd, subtype: "novadigm.edm", suffix: nil),
-  .edx: MIMEType._Core(type: .application, tree: .vnd, subtype: "novadigm.edx", suffix: nil),
-  .efif: MIMEType._Core(type: .application, tree: .vnd, subtype: "picsel", suffix: nil),
-  .ei6: MIMEType._Core(type: .application, tree: .vnd, subtype: "pg.osasli", suffix: nil),
-  .elc: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .emf: MIMEType._Core(type: .application, tree: nil, subtype: "x-msmetafile", suffix: nil),
-  .eml: MIMEType._Core(type: .message, tree: nil, subtype: "rfc822", suffix: nil),
-  .emma: MIMEType._Core(type: .application, tree: nil, subtype: "emma", suffix: .xml),
-  .emz: MIMEType._Core(type: .application, tree: nil, subtype: "x-msmetafile", suffix: nil),
-  .eol: MIMEType._Core(type: .audio, tree: .vnd, subtype: "digital-winds", suffix: nil),
-  .eot: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-fontobject", suffix: nil),
-  .eps: MIMEType._Core(type: .application, tree: nil, subtype: "postscript", suffix: nil),
-  .epub: MIMEType._Core(type: .application, tree: nil, subtype: "epub", suffix: .zip),
-  .es3: MIMEType._Core(type: .application, tree: .vnd, subtype: "eszigno3", suffix: .xml),
-  .esa: MIMEType._Core(type: .application, tree: .vnd, subtype: "osgi.subsystem", suffix: nil),
-  .esf: MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.esf", suffix: nil),
-  .et3: MIMEType._Core(type: .application, tree: .vnd, subtype: "eszigno3", suffix: .xml),
-  .etx: MIMEType._Core(type: .text, tree: nil, subtype: "x-setext", suffix: nil),
-  .eva: MIMEType._Core(type: .application, tree: nil, subtype: "x-eva", suffix: nil),
-  .evy: MIMEType._Core(type: .application, tree: nil, subtype: "x-envoy", suffix: nil),
-  .exe: MIMEType._Core(type: .application, tree: nil, subtype: "x-msdownload", suffix: nil),
-  .exi: MIMEType._Core(type: .application, tree: nil, subtype: "exi", suffix: nil),
-  .ext: MIMEType._Core(type: .application, tree: .vnd, subtype: "novadigm.ext", suffix: nil),
-  .ez: MIMEType._Core(type: .application, tree: nil, subtype: "andrew-inset", suffix: nil),
-  .ez2: MIMEType._Core(type: .application, tree: .vnd, subtype: "ezpix-album", suffix: nil),
-  .ez3: MIMEType._Core(type: .application, tree: .vnd, subtype: "ezpix-package", suffix: nil),
-  .f: MIMEType._Core(type: .text, tree: nil, subtype: "x-fortran", suffix: nil),
-  .f4v: MIMEType._Core(type: .video, tree: nil, subtype: "x-f4v", suffix: nil),
-  .f77: MIMEType._Core(type: .text, tree: nil, subtype: "x-fortran", suffix: nil),
-  .f90: MIMEType._Core(type: .text, tree: nil, subtype: "x-fortran", suffix: nil),
-  .fbs: MIMEType._Core(type: .image, tree: .vnd, subtype: "fastbidsheet", suffix: nil),
-  .fcdt: MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.formscentral.fcdt", suffix: nil),
-  .fcs: MIMEType._Core(type: .application, tree: .vnd, subtype: "isac.fcs", suffix: nil),
-  .fdf: MIMEType._Core(type: .application, tree: .vnd, subtype: "fdf", suffix: nil),
-  .feLaunch: MIMEType._Core(type: .application, tree: .vnd, subtype: "denovo.fcselayout-link", suffix: nil),
-  .fg5: MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasysgp", suffix: nil),
-  .fgd: MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
-  .fh: MIMEType._Core(type: .image, tree: nil, subtype: "x-freehand", suffix: nil),
-  .fh4: MIMEType._Core(type: .image, tree: nil, subtype: "x-freehand", suffix: nil),
-  .fh5: MIMEType._Core(type: .image, tree: nil, subtype: "x-freehand", suffix: nil),
-  .fh7: MIMEType._Core(type: .image, tree: nil, subtype: "x-freehand", suffix: nil),
-  .fhc: MIMEType._Core(type: .image, tree: nil, subtype: "x-freehand", suffix: nil),
-  .fig: MIMEType._Core(type: .application, tree: nil, subtype: "x-xfig", suffix: nil),
-  .flac: MIMEType._Core(type: .audio, tree: nil, subtype: "x-flac", suffix: nil),
-  .fli: MIMEType._Core(type: .video, tree: nil, subtype: "x-fli", suffix: nil),
-  .flo: MIMEType._Core(type: .application, tree: .vnd, subtype: "micrografx.flo", suffix: nil),
-  .flv: MIMEType._Core(type: .video, tree: nil, subtype: "x-flv", suffix: nil),
-  .flw: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kivio", suffix: nil),
-  .flx: MIMEType._Core(type: .text, tree: .vnd, subtype: "fmi.flexstor", suffix: nil),
-  .fly: MIMEType._Core(type: .text, tree: .vnd, subtype: "fly", suffix: nil),
-  .fm: MIMEType._Core(type: .application, tree: .vnd, subtype: "framemaker", suffix: nil),
-  .fnc: MIMEType._Core(type: .application, tree: .vnd, subtype: "frogans.fnc", suffix: nil),
-  .`for`: MIMEType._Core(type: .text, tree: nil, subtype: "x-fortran", suffix: nil),
-  .fpx: MIMEType._Core(type: .image, tree: .vnd, subtype: "fpx", suffix: nil),
-  .frame: MIMEType._Core(type: .application, tree: .vnd, subtype: "framemaker", suffix: nil),
-  .fsc: MIMEType._Core(type: .application, tree: .vnd, subtype: "fsc.weblaunch", suffix: nil),
-  .fst: MIMEType._Core(type: .image, tree: .vnd, subtype: "fst", suffix: nil),
-  .ftc: MIMEType._Core(type: .application, tree: .vnd, subtype: "fluxtime.clip", suffix: nil),
-  .fti: MIMEType._Core(type: .application, tree: .vnd, subtype: "anser-web-funds-transfer-initiation", suffix: nil),
-  .fvt: MIMEType._Core(type: .video, tree: .vnd, subtype: "fvt", suffix: nil),
-  .fxp: MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.fxp", suffix: nil),
-  .fxpl: MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.fxp", suffix: nil),
-  .fzs: MIMEType._Core(type: .application, tree: .vnd, subtype: "fuzzysheet", suffix: nil),
-  .g2w: MIMEType._Core(type: .application, tree: .vnd, subtype: "geoplan", suffix: nil),
-  .g3: MIMEType._Core(type: .image, tree: nil, subtype: "g3fax", suffix: nil),
-  .g3w: MIMEType._Core(type: .application, tree: .vnd, subtype: "geospace", suffix: nil),
-  .gac: MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-account", suffix: nil),
-  .gam: MIMEType._Core(type: .application, tree: nil, subtype: "x-tads", suffix: nil),
-  .gbr: MIMEType._Core(type: .application, tree: nil, subtype: "rpki-ghostbusters", suffix: nil),
-  .gca: MIMEType._Core(type: .application, tree: nil, subtype: "x-gca-compressed", suffix: nil),
-  .gdl: MIMEType._Core(type: .model, tree: .vnd, subtype: "gdl", suffix: nil),
-  .geo: MIMEType._Core(type: .application, tree: .vnd, subtype: "dynageo", suffix: nil),
-  .gex: MIMEType._Core(type: .application, tree: .vnd, subtype: "geometry-explorer", suffix: nil),
-  .ggb: MIMEType._Core(type: .application, tree: .vnd, subtype: "geogebra.file", suffix: nil),
-  .ggs: MIMEType._Core(type: .application, tree: .vnd, subtype: "geogebra.slides", suffix: nil),
-  .ggt: MIMEType._Core(type: .application, tree: .vnd, subtype: "geogebra.tool", suffix: nil),
-  .ghf: MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-help", suffix: nil),
-  .gif: MIMEType._Core(type: .image, tree: nil, subtype: "gif", suffix: nil),
-  .gim: MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-identity-message", suffix: nil),
-  .gml: MIMEType._Core(type: .application, tree: nil, subtype: "gml", suffix: .xml),
-  .gmx: MIMEType._Core(type: .application, tree: .vnd, subtype: "gmx", suffix: nil),
-  .gnumeric: MIMEType._Core(type: .application, tree: nil, subtype: "x-gnumeric", suffix: nil),
-  .gph: MIMEType._Core(type: .application, tree: .vnd, subtype: "flographit", suffix: nil),
-  .gpx: MIMEType._Core(type: .application, tree: nil, subtype: "gpx", suffix: .xml),
-  .gqf: MIMEType._Core(type: .application, tree: .vnd, subtype: "grafeq", suffix: nil),
-  .gqs: MIMEType._Core(type: .application, tree: .vnd, subtype: "grafeq", suffix: nil),
-  .gram: MIMEType._Core(type: .application, tree: nil, subtype: "srgs", suffix: nil),
-  .gramps: MIMEType._Core(type: .application, tree: nil, subtype: "x-gramps-xml", suffix: nil),
-  .gre: MIMEType._Core(type: .application, tree: .vnd, subtype: "geometry-explorer", suffix: nil),
-  .grv: MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-injector", suffix: nil),
-  .grxml: MIMEType._Core(type: .application, tree: nil, subtype: "srgs", suffix: .xml),
-  .gsf: MIMEType._Core(type: .application, tree: nil, subtype: "x-font-ghostscript", suffix: nil),
-  .gtar: MIMEType._Core(type: .application, tree: nil, subtype: "x-gtar", suffix: nil),
-  .gtm: MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-tool-message", suffix: nil),
-  .gtw: MIMEType._Core(type: .model, tree: .vnd, subtype: "gtw", suffix: nil),
-  .gv: MIMEType._Core(type: .text, tree: .vnd, subtype: "graphviz", suffix: nil),
-  .gxf: MIMEType._Core(type: .application, tree: nil, subtype: "gxf", suffix: nil),
-  .gxt: MIMEType._Core(type: .application, tree: .vnd, subtype: "geonext", suffix: nil),
-  .h: MIMEType._Core(type: .text, tree: nil, subtype: "x-c", suffix: nil),
-  .h261: MIMEType._Core(type: .video, tree: nil, subtype: "h261", suffix: nil),
-  .h263: MIMEType._Core(type: .video, tree: nil, subtype: "h263", suffix: nil),
-  .h264: MIMEType._Core(type: .video, tree: nil, subtype: "h264", suffix: nil),
-  .hal: MIMEType._Core(type: .application, tree: .vnd, subtype: "hal", suffix: .xml),
-  .hbci: MIMEType._Core(type: .application, tree: .vnd, subtype: "hbci", suffix: nil),
-  .hdf: MIMEType._Core(type: .application, tree: nil, subtype: "x-hdf", suffix: nil),
-  .hh: MIMEType._Core(type: .text, tree: nil, subtype: "x-c", suffix: nil),
-  .hlp: MIMEType._Core(type: .application, tree: nil, subtype: "winhlp", suffix: nil),
-  .hpgl: MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-hpgl", suffix: nil),
-  .hpid: MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-hpid", suffix: nil),
-  .hps: MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-hps", suffix: nil),
-  .hqx: MIMEType._Core(type: .application, tree: nil, subtype: "mac-binhex40", suffix: nil),
-  .htke: MIMEType._Core(type: .application, tree: .vnd, subtype: "kenameaapp", suffix: nil),
-  .htm: MIMEType._Core(type: .text, tree: nil, subtype: "html", suffix: nil),
-  .html: MIMEType._Core(type: .text, tree: nil, subtype: "html", suffix: nil),
-  .hvd: MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.hv-dic", suffix: nil),
-  .hvp: MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.hv-voice", suffix: nil),
-  .hvs: MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.hv-script", suffix: nil),
-  .i2g: MIMEType._Core(type: .application, tree: .vnd, subtype: "intergeo", suffix: nil),
-  .icc: MIMEType._Core(type: .application, tree: .vnd, subtype: "iccprofile", suffix: nil),
-  .icm: MIMEType._Core(type: .application, tree: .vnd, subtype: "iccprofile", suffix: nil),
-  .ico: MIMEType._Core(type: .image, tree: nil, subtype: "x-icon", suffix: nil),
-  .ics: MIMEType._Core(type: .text, tree: nil, subtype: "calendar", suffix: nil),
-  .ief: MIMEType._Core(type: .image, tree: nil, subtype: "ief", suffix: nil),
-  .ifb: MIMEType._Core(type: .text, tree: nil, subtype: "calendar", suffix: nil),
-  .ifm: MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.formdata", suffix: nil),
-  .iges: MIMEType._Core(type: .model, tree: nil, subtype: "iges", suffix: nil),
-  .igl: MIMEType._Core(type: .application, tree: .vnd, subtype: "igloader", suffix: nil),
-  .igm: MIMEType._Core(type: .application, tree: .vnd, subtype: "insors.igm", suffix: nil),
-  .igs: MIMEType._Core(type: .model, tree: nil, subtype: "iges", suffix: nil),
-  .igx: MIMEType._Core(type: .application, tree: .vnd, subtype: "micrografx.igx", suffix: nil),
-  .iif: MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.interchange", suffix: nil),
-  .imp: MIMEType._Core(type: .application, tree: .vnd, subtype: "accpac.simply.imp", suffix: nil),
-  .ims: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-ims", suffix: nil),
-  .`in`: MIMEType._Core(type: .text, tree: nil, subtype: "plain", suffix: nil),
-  .ink: MIMEType._Core(type: .application, tree: nil, subtype: "inkml", suffix: .xml),
-  .inkml: MIMEType._Core(type: .application, tree: nil, subtype: "inkml", suffix: .xml),
-  .install: MIMEType._Core(type: .application, tree: nil, subtype: "x-install-instructions", suffix: nil),
-  .iota: MIMEType._Core(type: .application, tree: .vnd, subtype: "astraea-software.iota", suffix: nil),
-  .ipfix: MIMEType._Core(type: .application, tree: nil, subtype: "ipfix", suffix: nil),
-  .ipk: MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.package", suffix: nil),
-  .irm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.rights-management", suffix: nil),
-  .irp: MIMEType._Core(type: .application, tree: .vnd, subtype: "irepository.package", suffix: .xml),
-  .iso: MIMEType._Core(type: .application, tree: nil, subtype: "x-iso9660-image", suffix: nil),
-  .itp: MIMEType._Core(type: .application, tree: .vnd, subtype: "shana.informed.formtemplate", suffix: nil),
-  .ivp: MIMEType._Core(type: .application, tree: .vnd, subtype: "immervision-ivp", suffix: nil),
-  .ivu: MIMEType._Core(type: .application, tree: .vnd, subtype: "immervision-ivu", suffix: nil),
-  .jad: MIMEType._Core(type: .text, tree: .vnd, subtype: "sun.j2me.app-descriptor", suffix: nil),
-  .jam: MIMEType._Core(type: .application, tree: .vnd, subtype: "jam", suffix: nil),
-  .jar: MIMEType._Core(type: .application, tree: nil, subtype: "java-archive", suffix: nil),
-  .java: MIMEType._Core(type: .text, tree: nil, subtype: "x-java-source", suffix: nil),
-  .jisp: MIMEType._Core(type: .application, tree: .vnd, subtype: "jisp", suffix: nil),
-  .jlt: MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-jlyt", suffix: nil),
-  .jnlp: MIMEType._Core(type: .application, tree: nil, subtype: "x-java-jnlp-file", suffix: nil),
-  .joda: MIMEType._Core(type: .application, tree: .vnd, subtype: "joost.joda-archive", suffix: nil),
-  .jpe: MIMEType._Core(type: .image, tree: nil, subtype: "jpeg", suffix: nil),
-  .jpeg: MIMEType._Core(type: .image, tree: nil, subtype: "jpeg", suffix: nil),
-  .jpg: MIMEType._Core(type: .image, tree: nil, subtype: "jpeg", suffix: nil),
-  .jpgm: MIMEType._Core(type: .video, tree: nil, subtype: "jpm", suffix: nil),
-  .jpgv: MIMEType._Core(type: .video, tree: nil, subtype: "jpeg", suffix: nil),
-  .jpm: MIMEType._Core(type: .video, tree: nil, subtype: "jpm", suffix: nil),
-  .js: MIMEType._Core(type: .text, tree: nil, subtype: "javascript", suffix: nil),
-  .json: MIMEType._Core(type: .application, tree: nil, subtype: "json", suffix: nil),
-  .jsonml: MIMEType._Core(type: .application, tree: nil, subtype: "jsonml", suffix: .json),
-  .jxl: MIMEType._Core(type: .image, tree: nil, subtype: "jxl", suffix: nil),
-  .kar: MIMEType._Core(type: .audio, tree: nil, subtype: "midi", suffix: nil),
-  .karbon: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.karbon", suffix: nil),
-  .kfo: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kformula", suffix: nil),
-  .kia: MIMEType._Core(type: .application, tree: .vnd, subtype: "kidspiration", suffix: nil),
-  .kml: MIMEType._Core(type: .application, tree: .vnd, subtype: "google-earth.kml", suffix: .xml),
-  .kmz: MIMEType._Core(type: .application, tree: .vnd, subtype: "google-earth.kmz", suffix: nil),
-  .kne: MIMEType._Core(type: .application, tree: .vnd, subtype: "kinar", suffix: nil),
-  .knp: MIMEType._Core(type: .application, tree: .vnd, subtype: "kinar", suffix: nil),
-  .kon: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kontour", suffix: nil),
-  .kpr: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kpresenter", suffix: nil),
-  .kpt: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kpresenter", suffix: nil),
-  .kpxx: MIMEType._Core(type: .application, tree: .vnd, subtype: "ds-keypoint", suffix: nil),
-  .ksp: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kspread", suffix: nil),
-  .ktr: MIMEType._Core(type: .application, tree: .vnd, subtype: "kahootz", suffix: nil),
-  .ktx: MIMEType._Core(type: .image, tree: nil, subtype: "ktx", suffix: nil),
-  .ktz: MIMEType._Core(type: .application, tree: .vnd, subtype: "kahootz", suffix: nil),
-  .kwd: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kword", suffix: nil),
-  .kwt: MIMEType._Core(type: .application, tree: .vnd, subtype: "kde.kword", suffix: nil),
-  .lasxml: MIMEType._Core(type: .application, tree: .vnd, subtype: "las.las", suffix: .xml),
-  .latex: MIMEType._Core(type: .application, tree: nil, subtype: "x-latex", suffix: nil),
-  .lbd: MIMEType._Core(type: .application, tree: .vnd, subtype: "llamagraphics.life-balance.desktop", suffix: nil),
-  .lbe: MIMEType._Core(type: .application, tree: .vnd, subtype: "llamagraphics.life-balance.exchange", suffix: .xml),
-  .les: MIMEType._Core(type: .application, tree: .vnd, subtype: "hhe.lesson-player", suffix: nil),
-  .lha: MIMEType._Core(type: .application, tree: nil, subtype: "x-lzh-compressed", suffix: nil),
-  .link66: MIMEType._Core(type: .application, tree: .vnd, subtype: "route66.link66", suffix: .xml),
-  .list: MIMEType._Core(type: .text, tree: nil, subtype: "plain", suffix: nil),
-  .list3820: MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.modcap", suffix: nil),
-  .listafp: MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.modcap", suffix: nil),
-  .lnk: MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-shortcut", suffix: nil),
-  .log: MIMEType._Core(type: .text, tree: nil, subtype: "plain", suffix: nil),
-  .lostxml: MIMEType._Core(type: .application, tree: nil, subtype: "lost", suffix: .xml),
-  .lrf: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .lrm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-lrm", suffix: nil),
-  .ltf: MIMEType._Core(type: .application, tree: .vnd, subtype: "frogans.ltf", suffix: nil),
-  .lvp: MIMEType._Core(type: .audio, tree: .vnd, subtype: "lucent.voice", suffix: nil),
-  .lwp: MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-wordpro", suffix: nil),
-  .lzh: MIMEType._Core(type: .application, tree: nil, subtype: "x-lzh-compressed", suffix: nil),
-  .m13: MIMEType._Core(type: .application, tree: nil, subtype: "x-msmediaview", suffix: nil),
-  .m14: MIMEType._Core(type: .application, tree: nil, subtype: "x-msmediaview", suffix: nil),
-  .m1v: MIMEType._Core(type: .video, tree: nil, subtype: "mpeg", suffix: nil),
-  .m21: MIMEType._Core(type: .application, tree: nil, subtype: "mp21", suffix: nil),
-  .m2a: MIMEType._Core(type: .audio, tree: nil, subtype: "mpeg", suffix: nil),
-  .m2t: MIMEType._Core(type: .video, tree: nil, subtype: "mp2t", suffix: nil),
-  .m2ts: MIMEType._Core(type: .video, tree: nil, subtype: "mp2t", suffix: nil),
-  .m2v: MIMEType._Core(type: .video, tree: nil, subtype: "mpeg", suffix: nil),
-  .m3a: MIMEType._Core(type: .audio, tree: nil, subtype: "mpeg", suffix: nil),
-  .m3u: MIMEType._Core(type: .audio, tree: nil, subtype: "x-mpegurl", suffix: nil),
-  .m3u8: MIMEType._Core(type: .application, tree: .vnd, subtype: "apple.mpegurl", suffix: nil),
-  .m4a: MIMEType._Core(type: .audio, tree: nil, subtype: "mp4", suffix: nil),
-  .m4u: MIMEType._Core(type: .video, tree: .vnd, subtype: "mpegurl", suffix: nil),
-  .m4v: MIMEType._Core(type: .video, tree: nil, subtype: "x-m4v", suffix: nil),
-  .ma: MIMEType._Core(type: .application, tree: nil, subtype: "mathematica", suffix: nil),
-  .mads: MIMEType._Core(type: .application, tree: nil, subtype: "mads", suffix: .xml),
-  .mag: MIMEType._Core(type: .application, tree: .vnd, subtype: "ecowin.chart", suffix: nil),
-  .maker: MIMEType._Core(type: .application, tree: .vnd, subtype: "framemaker", suffix: nil),
-  .man: MIMEType._Core(type: .text, tree: nil, subtype: "troff", suffix: nil),
-  .mar: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .mathml: MIMEType._Core(type: .application, tree: nil, subtype: "mathml", suffix: .xml),
-  .mb: MIMEType._Core(type: .application, tree: nil, subtype: "mathematica", suffix: nil),
-  .mbk: MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.mbk", suffix: nil),
-  .mbox: MIMEType._Core(type: .application, tree: nil, subtype: "mbox", suffix: nil),
-  .mc1: MIMEType._Core(type: .application, tree: .vnd, subtype: "medcalcdata", suffix: nil),
-  .mcd: MIMEType._Core(type: .application, tree: .vnd, subtype: "mcd", suffix: nil),
-  .mcurl: MIMEType._Core(type: .text, tree: .vnd, subtype: "curl.mcurl", suffix: nil),
-  .mdb: MIMEType._Core(type: .application, tree: nil, subtype: "x-msaccess", suffix: nil),
-  .mdi: MIMEType._Core(type: .image, tree: .vnd, subtype: "ms-modi", suffix: nil),
-  .me: MIMEType._Core(type: .text, tree: nil, subtype: "troff", suffix: nil),
-  .mesh: MIMEType._Core(type: .model, tree: nil, subtype: "mesh", suffix: nil),
-  .meta4: MIMEType._Core(type: .application, tree: nil, subtype: "metalink4", suffix: .xml),
-  .metalink: MIMEType._Core(type: .application, tree: nil, subtype: "metalink", suffix: .xml),
-  .mets: MIMEType._Core(type: .application, tree: nil, subtype: "mets", suffix: .xml),
-  .mfm: MIMEType._Core(type: .application, tree: .vnd, subtype: "mfmp", suffix: nil),
-  .mft: MIMEType._Core(type: .application, tree: nil, subtype: "rpki-manifest", suffix: nil),
-  .mgp: MIMEType._Core(type: .application, tree: .vnd, subtype: "osgeo.mapguide.package", suffix: nil),
-  .mgz: MIMEType._Core(type: .application, tree: .vnd, subtype: "proteus.magazine", suffix: nil),
-  .mid: MIMEType._Core(type: .audio, tree: nil, subtype: "midi", suffix: nil),
-  .midi: MIMEType._Core(type: .audio, tree: nil, subtype: "midi", suffix: nil),
-  .mie: MIMEType._Core(type: .application, tree: nil, subtype: "x-mie", suffix: nil),
-  .mif: MIMEType._Core(type: .application, tree: .vnd, subtype: "mif", suffix: nil),
-  .mime: MIMEType._Core(type: .message, tree: nil, subtype: "rfc822", suffix: nil),
-  .mj2: MIMEType._Core(type: .video, tree: nil, subtype: "mj2", suffix: nil),
-  .mjp2: MIMEType._Core(type: .video, tree: nil, subtype: "mj2", suffix: nil),
-  .mjs: MIMEType._Core(type: .text, tree: nil, subtype: "javascript", suffix: nil),
-  .mk3d: MIMEType._Core(type: .video, tree: nil, subtype: "x-matroska", suffix: nil),
-  .mka: MIMEType._Core(type: .audio, tree: nil, subtype: "x-matroska", suffix: nil),
-  .mks: MIMEType._Core(type: .video, tree: nil, subtype: "x-matroska", suffix: nil),
-  .mkv: MIMEType._Core(type: .video, tree: nil, subtype: "x-matroska", suffix: nil),
-  .mlp: MIMEType._Core(type: .application, tree: .vnd, subtype: "dolby.mlp", suffix: nil),
-  .mmd: MIMEType._Core(type: .application, tree: .vnd, subtype: "chipnuts.karaoke-mmd", suffix: nil),
-  .mmf: MIMEType._Core(type: .application, tree: .vnd, subtype: "smaf", suffix: nil),
-  .mmr: MIMEType._Core(type: .image, tree: .vnd, subtype: "fujixerox.edmics-mmr", suffix: nil),
-  .mng: MIMEType._Core(type: .video, tree: nil, subtype: "x-mng", suffix: nil),
-  .mny: MIMEType._Core(type: .application, tree: nil, subtype: "x-msmoney", suffix: nil),
-  .mobi: MIMEType._Core(type: .application, tree: nil, subtype: "x-mobipocket-ebook", suffix: nil),
-  .mods: MIMEType._Core(type: .application, tree: nil, subtype: "mods", suffix: .xml),
-  .mov: MIMEType._Core(type: .video, tree: nil, subtype: "quicktime", suffix: nil),
-  .movie: MIMEType._Core(type: .video, tree: nil, subtype: "x-sgi-movie", suffix: nil),
-  .mp2: MIMEType._Core(type: .audio, tree: nil, subtype: "mpeg", suffix: nil),
-  .mp21: MIMEType._Core(type: .application, tree: nil, subtype: "mp21", suffix: nil),
-  .mp2a: MIMEType._Core(type: .audio, tree: nil, subtype: "mpeg", suffix: nil),
-  .mp3: MIMEType._Core(type: .audio, tree: nil, subtype: "mpeg", suffix: nil),
-  .mp4: MIMEType._Core(type: .video, tree: nil, subtype: "mp4", suffix: nil),
-  .mp4a: MIMEType._Core(type: .audio, tree: nil, subtype: "mp4", suffix: nil),
-  .mp4s: MIMEType._Core(type: .application, tree: nil, subtype: "mp4", suffix: nil),
-  .mp4v: MIMEType._Core(type: .video, tree: nil, subtype: "mp4", suffix: nil),
-  .mpc: MIMEType._Core(type: .application, tree: .vnd, subtype: "mophun.certificate", suffix: nil),
-  .mpe: MIMEType._Core(type: .video, tree: nil, subtype: "mpeg", suffix: nil),
-  .mpeg: MIMEType._Core(type: .video, tree: nil, subtype: "mpeg", suffix: nil),
-  .mpg: MIMEType._Core(type: .video, tree: nil, subtype: "mpeg", suffix: nil),
-  .mpg4: MIMEType._Core(type: .video, tree: nil, subtype: "mp4", suffix: nil),
-  .mpga: MIMEType._Core(type: .audio, tree: nil, subtype: "mpeg", suffix: nil),
-  .mpkg: MIMEType._Core(type: .application, tree: .vnd, subtype: "apple.installer", suffix: .xml),
-  .mpm: MIMEType._Core(type: .application, tree: .vnd, subtype: "blueice.multipass", suffix: nil),
-  .mpn: MIMEType._Core(type: .application, tree: .vnd, subtype: "mophun.application", suffix: nil),
-  .mpp: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-project", suffix: nil),
-  .mpt: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-project", suffix: nil),
-  .mpy: MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.minipay", suffix: nil),
-  .mqy: MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.mqy", suffix: nil),
-  .mrc: MIMEType._Core(type: .application, tree: nil, subtype: "marc", suffix: nil),
-  .mrcx: MIMEType._Core(type: .application, tree: nil, subtype: "marcxml", suffix: .xml),
-  .ms: MIMEType._Core(type: .text, tree: nil, subtype: "troff", suffix: nil),
-  .mscml: MIMEType._Core(type: .application, tree: nil, subtype: "mediaservercontrol", suffix: .xml),
-  .mseed: MIMEType._Core(type: .application, tree: .vnd, subtype: "fdsn.mseed", suffix: nil),
-  .mseq: MIMEType._Core(type: .application, tree: .vnd, subtype: "mseq", suffix: nil),
-  .msf: MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.msf", suffix: nil),
-  .msh: MIMEType._Core(type: .model, tree: nil, subtype: "mesh", suffix: nil),
-  .msi: MIMEType._Core(type: .application, tree: nil, subtype: "x-msdownload", suffix: nil),
-  .msl: MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.msl", suffix: nil),
-  .msty: MIMEType._Core(type: .application, tree: .vnd, subtype: "muvee.style", suffix: nil),
-  .mts: MIMEType._Core(type: .video, tree: nil, subtype: "mp2t", suffix: nil),
-  .mus: MIMEType._Core(type: .application, tree: .vnd, subtype: "musician", suffix: nil),
-  .musicxml: MIMEType._Core(type: .application, tree: .vnd, subtype: "recordare.musicxml", suffix: .xml),
-  .mvb: MIMEType._Core(type: .application, tree: nil, subtype: "x-msmediaview", suffix: nil),
-  .mwf: MIMEType._Core(type: .application, tree: .vnd, subtype: "mfer", suffix: nil),
-  .mxf: MIMEType._Core(type: .application, tree: nil, subtype: "mxf", suffix: nil),
-  .mxl: MIMEType._Core(type: .application, tree: .vnd, subtype: "recordare.musicxml", suffix: nil),
-  .mxml: MIMEType._Core(type: .application, tree: nil, subtype: "xv", suffix: .xml),
-  .mxs: MIMEType._Core(type: .application, tree: .vnd, subtype: "triscape.mxs", suffix: nil),
-  .mxu: MIMEType._Core(type: .video, tree: .vnd, subtype: "mpegurl", suffix: nil),
-  .nGage: MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.n-gage.symbian.install", suffix: nil),
-  .n3: MIMEType._Core(type: .text, tree: nil, subtype: "n3", suffix: nil),
-  .nb: MIMEType._Core(type: .application, tree: nil, subtype: "mathematica", suffix: nil),
-  .nbp: MIMEType._Core(type: .application, tree: .vnd, subtype: "wolfram.player", suffix: nil),
-  .nc: MIMEType._Core(type: .application, tree: nil, subtype: "x-netcdf", suffix: nil),
-  .ncx: MIMEType._Core(type: .application, tree: nil, subtype: "x-dtbncx", suffix: .xml),
-  .nfo: MIMEType._Core(type: .text, tree: nil, subtype: "x-nfo", suffix: nil),
-  .ngdat: MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.n-gage.data", suffix: nil),
-  .nitf: MIMEType._Core(type: .application, tree: .vnd, subtype: "nitf", suffix: nil),
-  .nlu: MIMEType._Core(type: .application, tree: .vnd, subtype: "neurolanguage.nlu", suffix: nil),
-  .nml: MIMEType._Core(type: .application, tree: .vnd, subtype: "enliven", suffix: nil),
-  .nnd: MIMEType._Core(type: .application, tree: .vnd, subtype: "noblenet-directory", suffix: nil),
-  .nns: MIMEType._Core(type: .application, tree: .vnd, subtype: "noblenet-sealer", suffix: nil),
-  .nnw: MIMEType._Core(type: .application, tree: .vnd, subtype: "noblenet-web", suffix: nil),
-  .npx: MIMEType._Core(type: .image, tree: .vnd, subtype: "net-fpx", suffix: nil),
-  .nsc: MIMEType._Core(type: .application, tree: nil, subtype: "x-conference", suffix: nil),
-  .nsf: MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-notes", suffix: nil),
-  .ntf: MIMEType._Core(type: .application, tree: .vnd, subtype: "nitf", suffix: nil),
-  .nzb: MIMEType._Core(type: .application, tree: nil, subtype: "x-nzb", suffix: nil),
-  .oa2: MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasys2", suffix: nil),
-  .oa3: MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasys3", suffix: nil),
-  .oas: MIMEType._Core(type: .application, tree: .vnd, subtype: "fujitsu.oasys", suffix: nil),
-  .obd: MIMEType._Core(type: .application, tree: nil, subtype: "x-msbinder", suffix: nil),
-  .obj: MIMEType._Core(type: .application, tree: nil, subtype: "x-tgif", suffix: nil),
-  .oda: MIMEType._Core(type: .application, tree: nil, subtype: "oda", suffix: nil),
-  .odb: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.database", suffix: nil),
-  .odc: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.chart", suffix: nil),
-  .odf: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.formula", suffix: nil),
-  .odft: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.formula-template", suffix: nil),
-  .odg: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.graphics", suffix: nil),
-  .odi: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.image", suffix: nil),
-  .odm: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text-master", suffix: nil),
-  .odp: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.presentation", suffix: nil),
-  .ods: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.spreadsheet", suffix: nil),
-  .odt: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text", suffix: nil),
-  .oga: MIMEType._Core(type: .audio, tree: nil, subtype: "ogg", suffix: nil),
-  .ogg: MIMEType._Core(type: .audio, tree: nil, subtype: "ogg", suffix: nil),
-  .ogv: MIMEType._Core(type: .video, tree: nil, subtype: "ogg", suffix: nil),
-  .ogx: MIMEType._Core(type: .application, tree: nil, subtype: "ogg", suffix: nil),
-  .omdoc: MIMEType._Core(type: .application, tree: nil, subtype: "omdoc", suffix: .xml),
-  .onepkg: MIMEType._Core(type: .application, tree: nil, subtype: "onenote", suffix: nil),
-  .onetmp: MIMEType._Core(type: .application, tree: nil, subtype: "onenote", suffix: nil),
-  .onetoc: MIMEType._Core(type: .application, tree: nil, subtype: "onenote", suffix: nil),
-  .onetoc2: MIMEType._Core(type: .application, tree: nil, subtype: "onenote", suffix: nil),
-  .opf: MIMEType._Core(type: .application, tree: nil, subtype: "oebps-package", suffix: .xml),
-  .opml: MIMEType._Core(type: .text, tree: nil, subtype: "x-opml", suffix: nil),
-  .oprc: MIMEType._Core(type: .application, tree: .vnd, subtype: "palm", suffix: nil),
-  .opus: MIMEType._Core(type: .audio, tree: nil, subtype: "ogg", suffix: nil),
-  .org: MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-organizer", suffix: nil),
-  .osf: MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.openscoreformat", suffix: nil),
-  .osfpvg: MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.openscoreformat.osfpvg", suffix: .xml),
-  .otc: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.chart-template", suffix: nil),
-  .otf: MIMEType._Core(type: .font, tree: nil, subtype: "otf", suffix: nil),
-  .otg: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.graphics-template", suffix: nil),
-  .oth: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text-web", suffix: nil),
-  .oti: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.image-template", suffix: nil),
-  .otp: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.presentation-template", suffix: nil),
-  .ots: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.spreadsheet-template", suffix: nil),
-  .ott: MIMEType._Core(type: .application, tree: .vnd, subtype: "oasis.opendocument.text-template", suffix: nil),
-  .oxps: MIMEType._Core(type: .application, tree: nil, subtype: "oxps", suffix: nil),
-  .oxt: MIMEType._Core(type: .application, tree: .vnd, subtype: "openofficeorg.extension", suffix: nil),
-  .p: MIMEType._Core(type: .text, tree: nil, subtype: "x-pascal", suffix: nil),
-  .p10: MIMEType._Core(type: .application, tree: nil, subtype: "pkcs10", suffix: nil),
-  .p12: MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs12", suffix: nil),
-  .p7b: MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs7-certificates", suffix: nil),
-  .p7c: MIMEType._Core(type: .application, tree: nil, subtype: "pkcs7-mime", suffix: nil),
-  .p7m: MIMEType._Core(type: .application, tree: nil, subtype: "pkcs7-mime", suffix: nil),
-  .p7r: MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs7-certreqresp", suffix: nil),
-  .p7s: MIMEType._Core(type: .application, tree: nil, subtype: "pkcs7-signature", suffix: nil),
-  .p8: MIMEType._Core(type: .application, tree: nil, subtype: "pkcs8", suffix: nil),
-  .pas: MIMEType._Core(type: .text, tree: nil, subtype: "x-pascal", suffix: nil),
-  .paw: MIMEType._Core(type: .application, tree: .vnd, subtype: "pawaafile", suffix: nil),
-  .pbd: MIMEType._Core(type: .application, tree: .vnd, subtype: "powerbuilder6", suffix: nil),
-  .pbm: MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-bitmap", suffix: nil),
-  .pcap: MIMEType._Core(type: .application, tree: .vnd, subtype: "tcpdump.pcap", suffix: nil),
-  .pcf: MIMEType._Core(type: .application, tree: nil, subtype: "x-font-pcf", suffix: nil),
-  .pcl: MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-pcl", suffix: nil),
-  .pclxl: MIMEType._Core(type: .application, tree: .vnd, subtype: "hp-pclxl", suffix: nil),
-  .pct: MIMEType._Core(type: .image, tree: nil, subtype: "x-pict", suffix: nil),
-  .pcurl: MIMEType._Core(type: .application, tree: .vnd, subtype: "curl.pcurl", suffix: nil),
-  .pcx: MIMEType._Core(type: .image, tree: nil, subtype: "x-pcx", suffix: nil),
-  .pdb: MIMEType._Core(type: .application, tree: .vnd, subtype: "palm", suffix: nil),
-  .pdf: MIMEType._Core(type: .application, tree: nil, subtype: "pdf", suffix: nil),
-  .pfa: MIMEType._Core(type: .application, tree: nil, subtype: "x-font-type1", suffix: nil),
-  .pfb: MIMEType._Core(type: .application, tree: nil, subtype: "x-font-type1", suffix: nil),
-  .pfm: MIMEType._Core(type: .application, tree: nil, subtype: "x-font-type1", suffix: nil),
-  .pfr: MIMEType._Core(type: .application, tree: nil, subtype: "font-tdpfr", suffix: nil),
-  .pfx: MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs12", suffix: nil),
-  .pgm: MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-graymap", suffix: nil),
-  .pgn: MIMEType._Core(type: .application, tree: nil, subtype: "x-chess-pgn", suffix: nil),
-  .pgp: MIMEType._Core(type: .application, tree: nil, subtype: "pgp-encrypted", suffix: nil),
-  .pic: MIMEType._Core(type: .image, tree: nil, subtype: "x-pict", suffix: nil),
-  .pkg: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .pki: MIMEType._Core(type: .application, tree: nil, subtype: "pkixcmp", suffix: nil),
-  .pkipath: MIMEType._Core(type: .application, tree: nil, subtype: "pkix-pkipath", suffix: nil),
-  .plb: MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp.pic-bw-large", suffix: nil),
-  .plc: MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.plc", suffix: nil),
-  .plf: MIMEType._Core(type: .application, tree: .vnd, subtype: "pocketlearn", suffix: nil),
-  .pls: MIMEType._Core(type: .application, tree: nil, subtype: "pls", suffix: .xml),
-  .pml: MIMEType._Core(type: .application, tree: .vnd, subtype: "ctc-posml", suffix: nil),
-  .png: MIMEType._Core(type: .image, tree: nil, subtype: "png", suffix: nil),
-  .pnm: MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-anymap", suffix: nil),
-  .portpkg: MIMEType._Core(type: .application, tree: .vnd, subtype: "macports.portpkg", suffix: nil),
-  .pot: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint", suffix: nil),
-  .potm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.template.macroenabled.12", suffix: nil),
-  .potx: MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.template", suffix: nil),
-  .ppam: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.addin.macroenabled.12", suffix: nil),
-  .ppd: MIMEType._Core(type: .application, tree: .vnd, subtype: "cups-ppd", suffix: nil),
-  .ppm: MIMEType._Core(type: .image, tree: nil, subtype: "x-portable-pixmap", suffix: nil),
-  .pps: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint", suffix: nil),
-  .ppsm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.slideshow.macroenabled.12", suffix: nil),
-  .ppsx: MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.slideshow", suffix: nil),
-  .ppt: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint", suffix: nil),
-  .pptm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.presentation.macroenabled.12", suffix: nil),
-  .pptx: MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.presentation", suffix: nil),
-  .pqa: MIMEType._Core(type: .application, tree: .vnd, subtype: "palm", suffix: nil),
-  .prc: MIMEType._Core(type: .application, tree: nil, subtype: "x-mobipocket-ebook", suffix: nil),
-  .pre: MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-freelance", suffix: nil),
-  .prf: MIMEType._Core(type: .application, tree: nil, subtype: "pics-rules", suffix: nil),
-  .ps: MIMEType._Core(type: .application, tree: nil, subtype: "postscript", suffix: nil),
-  .psb: MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp.pic-bw-small", suffix: nil),
-  .psd: MIMEType._Core(type: .image, tree: .vnd, subtype: "adobe.photoshop", suffix: nil),
-  .psf: MIMEType._Core(type: .application, tree: nil, subtype: "x-font-linux-psf", suffix: nil),
-  .pskcxml: MIMEType._Core(type: .application, tree: nil, subtype: "pskc", suffix: .xml),
-  .ptid: MIMEType._Core(type: .application, tree: .vnd, subtype: "pvi.ptid1", suffix: nil),
-  .pub: MIMEType._Core(type: .application, tree: nil, subtype: "x-mspublisher", suffix: nil),
-  .pvb: MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp.pic-bw-var", suffix: nil),
-  .pwn: MIMEType._Core(type: .application, tree: .vnd, subtype: "3m.post-it-notes", suffix: nil),
-  .pya: MIMEType._Core(type: .audio, tree: .vnd, subtype: "ms-playready.media.pya", suffix: nil),
-  .pyv: MIMEType._Core(type: .video, tree: .vnd, subtype: "ms-playready.media.pyv", suffix: nil),
-  .qam: MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.quickanime", suffix: nil),
-  .qbo: MIMEType._Core(type: .application, tree: .vnd, subtype: "intu.qbo", suffix: nil),
-  .qfx: MIMEType._Core(type: .application, tree: .vnd, subtype: "intu.qfx", suffix: nil),
-  .qps: MIMEType._Core(type: .application, tree: .vnd, subtype: "publishare-delta-tree", suffix: nil),
-  .qt: MIMEType._Core(type: .video, tree: nil, subtype: "quicktime", suffix: nil),
-  .qwd: MIMEType._Core(type: .application, tree: .vnd, subtype: "quark.quarkxpress", suffix: nil),
-  .qwt: MIMEType._Core(type: .application, tree: .vnd, subtype: "quark.quarkxpress", suffix: nil),
-  .qxb: MIMEType._Core(type: .application, tree: .vnd, subtype: "quark.quarkxpress", suffix: nil),
-  .qxd: MIMEType._Core(type: .application, tree: .vnd, subtype: "quark.quarkxpress", suffix: nil),
-  .qxl: MIMEType._Core(type: .application, tree: .vnd, subtype: "quark.quarkxpress", suffix: nil),
-  .qxt: MIMEType._Core(type: .application, tree: .vnd, subtype: "quark.quarkxpress", suffix: nil),
-  .ra: MIMEType._Core(type: .audio, tree: nil, subtype: "x-pn-realaudio", suffix: nil),
-  .ram: MIMEType._Core(type: .audio, tree: nil, subtype: "x-pn-realaudio", suffix: nil),
-  .rar: MIMEType._Core(type: .application, tree: nil, subtype: "x-rar-compressed", suffix: nil),
-  .ras: MIMEType._Core(type: .image, tree: nil, subtype: "x-cmu-raster", suffix: nil),
-  .rcprofile: MIMEType._Core(type: .application, tree: .vnd, subtype: "ipunplugged.rcprofile", suffix: nil),
-  .rdf: MIMEType._Core(type: .application, tree: nil, subtype: "rdf", suffix: .xml),
-  .rdz: MIMEType._Core(type: .application, tree: .vnd, subtype: "data-vision.rdz", suffix: nil),
-  .rep: MIMEType._Core(type: .application, tree: .vnd, subtype: "businessobjects", suffix: nil),
-  .res: MIMEType._Core(type: .application, tree: nil, subtype: "x-dtbresource", suffix: .xml),
-  .rgb: MIMEType._Core(type: .image, tree: nil, subtype: "x-rgb", suffix: nil),
-  .rif: MIMEType._Core(type: .application, tree: nil, subtype: "reginfo", suffix: .xml),
-  .rip: MIMEType._Core(type: .audio, tree: .vnd, subtype: "rip", suffix: nil),
-  .ris: MIMEType._Core(type: .application, tree: nil, subtype: "x-research-info-systems", suffix: nil),
-  .rl: MIMEType._Core(type: .application, tree: nil, subtype: "resource-lists", suffix: .xml),
-  .rlc: MIMEType._Core(type: .image, tree: .vnd, subtype: "fujixerox.edmics-rlc", suffix: nil),
-  .rld: MIMEType._Core(type: .application, tree: nil, subtype: "resource-lists-diff", suffix: .xml),
-  .rm: MIMEType._Core(type: .application, tree: .vnd, subtype: "rn-realmedia", suffix: nil),
-  .rmi: MIMEType._Core(type: .audio, tree: nil, subtype: "midi", suffix: nil),
-  .rmp: MIMEType._Core(type: .audio, tree: nil, subtype: "x-pn-realaudio-plugin", suffix: nil),
-  .rms: MIMEType._Core(type: .application, tree: .vnd, subtype: "jcp.javame.midlet-rms", suffix: nil),
-  .rmvb: MIMEType._Core(type: .application, tree: .vnd, subtype: "rn-realmedia-vbr", suffix: nil),
-  .rnc: MIMEType._Core(type: .application, tree: nil, subtype: "relax-ng-compact-syntax", suffix: nil),
-  .roa: MIMEType._Core(type: .application, tree: nil, subtype: "rpki-roa", suffix: nil),
-  .roff: MIMEType._Core(type: .text, tree: nil, subtype: "troff", suffix: nil),
-  .rp9: MIMEType._Core(type: .application, tree: .vnd, subtype: "cloanto.rp9", suffix: nil),
-  .rpss: MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.radio-presets", suffix: nil),
-  .rpst: MIMEType._Core(type: .application, tree: .vnd, subtype: "nokia.radio-preset", suffix: nil),
-  .rq: MIMEType._Core(type: .application, tree: nil, subtype: "sparql-query", suffix: nil),
-  .rs: MIMEType._Core(type: .application, tree: nil, subtype: "rls-services", suffix: .xml),
-  .rsd: MIMEType._Core(type: .application, tree: nil, subtype: "rsd", suffix: .xml),
-  .rss: MIMEType._Core(type: .application, tree: nil, subtype: "rss", suffix: .xml),
-  .rtf: MIMEType._Core(type: .application, tree: nil, subtype: "rtf", suffix: nil),
-  .rtx: MIMEType._Core(type: .text, tree: nil, subtype: "richtext", suffix: nil),
-  .s: MIMEType._Core(type: .text, tree: nil, subtype: "x-asm", suffix: nil),
-  .s3m: MIMEType._Core(type: .audio, tree: nil, subtype: "s3m", suffix: nil),
-  .saf: MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.smaf-audio", suffix: nil),
-  .sbml: MIMEType._Core(type: .application, tree: nil, subtype: "sbml", suffix: .xml),
-  .sc: MIMEType._Core(type: .application, tree: .vnd, subtype: "ibm.secure-container", suffix: nil),
-  .scd: MIMEType._Core(type: .application, tree: nil, subtype: "x-msschedule", suffix: nil),
-  .scm: MIMEType._Core(type: .application, tree: .vnd, subtype: "lotus-screencam", suffix: nil),
-  .scq: MIMEType._Core(type: .application, tree: nil, subtype: "scvp-cv-request", suffix: nil),
-  .scs: MIMEType._Core(type: .application, tree: nil, subtype: "scvp-cv-response", suffix: nil),
-  .scurl: MIMEType._Core(type: .text, tree: .vnd, subtype: "curl.scurl", suffix: nil),
-  .sda: MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.draw", suffix: nil),
-  .sdc: MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.calc", suffix: nil),
-  .sdd: MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.impress", suffix: nil),
-  .sdkd: MIMEType._Core(type: .application, tree: .vnd, subtype: "solent.sdkm", suffix: .xml),
-  .sdkm: MIMEType._Core(type: .application, tree: .vnd, subtype: "solent.sdkm", suffix: .xml),
-  .sdp: MIMEType._Core(type: .application, tree: nil, subtype: "sdp", suffix: nil),
-  .sdw: MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.writer", suffix: nil),
-  .see: MIMEType._Core(type: .application, tree: .vnd, subtype: "seemail", suffix: nil),
-  .seed: MIMEType._Core(type: .application, tree: .vnd, subtype: "fdsn.seed", suffix: nil),
-  .sema: MIMEType._Core(type: .application, tree: .vnd, subtype: "sema", suffix: nil),
-  .semd: MIMEType._Core(type: .application, tree: .vnd, subtype: "semd", suffix: nil),
-  .semf: MIMEType._Core(type: .application, tree: .vnd, subtype: "semf", suffix: nil),
-  .ser: MIMEType._Core(type: .application, tree: nil, subtype: "java-serialized-object", suffix: nil),
-  .setpay: MIMEType._Core(type: .application, tree: nil, subtype: "set-payment-initiation", suffix: nil),
-  .setreg: MIMEType._Core(type: .application, tree: nil, subtype: "set-registration-initiation", suffix: nil),
-  .sfdHdstx: MIMEType._Core(type: .application, tree: .vnd, subtype: "hydrostatix.sof-data", suffix: nil),
-  .sfs: MIMEType._Core(type: .application, tree: .vnd, subtype: "spotfire.sfs", suffix: nil),
-  .sfv: MIMEType._Core(type: .text, tree: nil, subtype: "x-sfv", suffix: nil),
-  .sgi: MIMEType._Core(type: .image, tree: nil, subtype: "sgi", suffix: nil),
-  .sgl: MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.writer-global", suffix: nil),
-  .sgm: MIMEType._Core(type: .text, tree: nil, subtype: "sgml", suffix: nil),
-  .sgml: MIMEType._Core(type: .text, tree: nil, subtype: "sgml", suffix: nil),
-  .sh: MIMEType._Core(type: .application, tree: nil, subtype: "x-sh", suffix: nil),
-  .shar: MIMEType._Core(type: .application, tree: nil, subtype: "x-shar", suffix: nil),
-  .shf: MIMEType._Core(type: .application, tree: nil, subtype: "shf", suffix: .xml),
-  .sid: MIMEType._Core(type: .image, tree: nil, subtype: "x-mrsid-image", suffix: nil),
-  .sig: MIMEType._Core(type: .application, tree: nil, subtype: "pgp-signature", suffix: nil),
-  .sil: MIMEType._Core(type: .audio, tree: nil, subtype: "silk", suffix: nil),
-  .silo: MIMEType._Core(type: .model, tree: nil, subtype: "mesh", suffix: nil),
-  .sis: MIMEType._Core(type: .application, tree: .vnd, subtype: "symbian.install", suffix: nil),
-  .sisx: MIMEType._Core(type: .application, tree: .vnd, subtype: "symbian.install", suffix: nil),
-  .sit: MIMEType._Core(type: .application, tree: nil, subtype: "x-stuffit", suffix: nil),
-  .sitx: MIMEType._Core(type: .application, tree: nil, subtype: "x-stuffitx", suffix: nil),
-  .skd: MIMEType._Core(type: .application, tree: .vnd, subtype: "koan", suffix: nil),
-  .skm: MIMEType._Core(type: .application, tree: .vnd, subtype: "koan", suffix: nil),
-  .skp: MIMEType._Core(type: .application, tree: .vnd, subtype: "koan", suffix: nil),
-  .skt: MIMEType._Core(type: .application, tree: .vnd, subtype: "koan", suffix: nil),
-  .sldm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-powerpoint.slide.macroenabled.12", suffix: nil),
-  .sldx: MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.presentationml.slide", suffix: nil),
-  .slt: MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.salt", suffix: nil),
-  .sm: MIMEType._Core(type: .application, tree: .vnd, subtype: "stepmania.stepchart", suffix: nil),
-  .smf: MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.math", suffix: nil),
-  .smi: MIMEType._Core(type: .application, tree: nil, subtype: "smil", suffix: .xml),
-  .smil: MIMEType._Core(type: .application, tree: nil, subtype: "smil", suffix: .xml),
-  .smv: MIMEType._Core(type: .video, tree: nil, subtype: "x-smv", suffix: nil),
-  .smzip: MIMEType._Core(type: .application, tree: .vnd, subtype: "stepmania.package", suffix: nil),
-  .snd: MIMEType._Core(type: .audio, tree: nil, subtype: "basic", suffix: nil),
-  .snf: MIMEType._Core(type: .application, tree: nil, subtype: "x-font-snf", suffix: nil),
-  .so: MIMEType._Core(type: .application, tree: nil, subtype: "octet-stream", suffix: nil),
-  .spc: MIMEType._Core(type: .application, tree: nil, subtype: "x-pkcs7-certificates", suffix: nil),
-  .spf: MIMEType._Core(type: .application, tree: .vnd, subtype: "yamaha.smaf-phrase", suffix: nil),
-  .spl: MIMEType._Core(type: .application, tree: nil, subtype: "x-futuresplash", suffix: nil),
-  .spot: MIMEType._Core(type: .text, tree: .vnd, subtype: "in3d.spot", suffix: nil),
-  .spp: MIMEType._Core(type: .application, tree: nil, subtype: "scvp-vp-response", suffix: nil),
-  .spq: MIMEType._Core(type: .application, tree: nil, subtype: "scvp-vp-request", suffix: nil),
-  .spx: MIMEType._Core(type: .audio, tree: nil, subtype: "ogg", suffix: nil),
-  .sql: MIMEType._Core(type: .application, tree: nil, subtype: "x-sql", suffix: nil),
-  .src: MIMEType._Core(type: .application, tree: nil, subtype: "x-wais-source", suffix: nil),
-  .srt: MIMEType._Core(type: .application, tree: nil, subtype: "x-subrip", suffix: nil),
-  .sru: MIMEType._Core(type: .application, tree: nil, subtype: "sru", suffix: .xml),
-  .srx: MIMEType._Core(type: .application, tree: nil, subtype: "sparql-results", suffix: .xml),
-  .ssdl: MIMEType._Core(type: .application, tree: nil, subtype: "ssdl", suffix: .xml),
-  .sse: MIMEType._Core(type: .application, tree: .vnd, subtype: "kodak-descriptor", suffix: nil),
-  .ssf: MIMEType._Core(type: .application, tree: .vnd, subtype: "epson.ssf", suffix: nil),
-  .ssml: MIMEType._Core(type: .application, tree: nil, subtype: "ssml", suffix: .xml),
-  .st: MIMEType._Core(type: .application, tree: .vnd, subtype: "sailingtracker.track", suffix: nil),
-  .stc: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.calc.template", suffix: nil),
-  .std: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.draw.template", suffix: nil),
-  .stf: MIMEType._Core(type: .application, tree: .vnd, subtype: "wt.stf", suffix: nil),
-  .sti: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.impress.template", suffix: nil),
-  .stk: MIMEType._Core(type: .application, tree: nil, subtype: "hyperstudio", suffix: nil),
-  .stl: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-pki.stl", suffix: nil),
-  .str: MIMEType._Core(type: .application, tree: .vnd, subtype: "pg.format", suffix: nil),
-  .stw: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.writer.template", suffix: nil),
-  .sub: MIMEType._Core(type: .text, tree: .vnd, subtype: "dvb.subtitle", suffix: nil),
-  .sus: MIMEType._Core(type: .application, tree: .vnd, subtype: "sus-calendar", suffix: nil),
-  .susp: MIMEType._Core(type: .application, tree: .vnd, subtype: "sus-calendar", suffix: nil),
-  .sv4cpio: MIMEType._Core(type: .application, tree: nil, subtype: "x-sv4cpio", suffix: nil),
-  .sv4crc: MIMEType._Core(type: .application, tree: nil, subtype: "x-sv4crc", suffix: nil),
-  .svc: MIMEType._Core(type: .application, tree: .vnd, subtype: "dvb.service", suffix: nil),
-  .svd: MIMEType._Core(type: .application, tree: .vnd, subtype: "svd", suffix: nil),
-  .svg: MIMEType._Core(type: .image, tree: nil, subtype: "svg", suffix: .xml),
-  .svgz: MIMEType._Core(type: .image, tree: nil, subtype: "svg", suffix: .xml),
-  .swa: MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
-  .swf: MIMEType._Core(type: .application, tree: nil, subtype: "x-shockwave-flash", suffix: nil),
-  .swi: MIMEType._Core(type: .application, tree: .vnd, subtype: "aristanetworks.swi", suffix: nil),
-  .sxc: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.calc", suffix: nil),
-  .sxd: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.draw", suffix: nil),
-  .sxg: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.writer.global", suffix: nil),
-  .sxi: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.impress", suffix: nil),
-  .sxm: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.math", suffix: nil),
-  .sxw: MIMEType._Core(type: .application, tree: .vnd, subtype: "sun.xml.writer", suffix: nil),
-  .t: MIMEType._Core(type: .text, tree: nil, subtype: "troff", suffix: nil),
-  .t3: MIMEType._Core(type: .application, tree: nil, subtype: "x-t3vm-image", suffix: nil),
-  .taglet: MIMEType._Core(type: .application, tree: .vnd, subtype: "mynfc", suffix: nil),
-  .tao: MIMEType._Core(type: .application, tree: .vnd, subtype: "tao.intent-module-archive", suffix: nil),
-  .tar: MIMEType._Core(type: .application, tree: nil, subtype: "x-tar", suffix: nil),
-  .tcap: MIMEType._Core(type: .application, tree: .vnd, subtype: "3gpp2.tcap", suffix: nil),
-  .tcl: MIMEType._Core(type: .application, tree: nil, subtype: "x-tcl", suffix: nil),
-  .teacher: MIMEType._Core(type: .application, tree: .vnd, subtype: "smart.teacher", suffix: nil),
-  .tei: MIMEType._Core(type: .application, tree: nil, subtype: "tei", suffix: .xml),
-  .teicorpus: MIMEType._Core(type: .application, tree: nil, subtype: "tei", suffix: .xml),
-  .tex: MIMEType._Core(type: .application, tree: nil, subtype: "x-tex", suffix: nil),
-  .texi: MIMEType._Core(type: .application, tree: nil, subtype: "x-texinfo", suffix: nil),
-  .texinfo: MIMEType._Core(type: .application, tree: nil, subtype: "x-texinfo", suffix: nil),
-  .text: MIMEType._Core(type: .text, tree: nil, subtype: "plain", suffix: nil),
-  .tfi: MIMEType._Core(type: .application, tree: nil, subtype: "thraud", suffix: .xml),
-  .tfm: MIMEType._Core(type: .application, tree: nil, subtype: "x-tex-tfm", suffix: nil),
-  .tga: MIMEType._Core(type: .image, tree: nil, subtype: "x-tga", suffix: nil),
-  .thmx: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-officetheme", suffix: nil),
-  .tif: MIMEType._Core(type: .image, tree: nil, subtype: "tiff", suffix: nil),
-  .tiff: MIMEType._Core(type: .image, tree: nil, subtype: "tiff", suffix: nil),
-  .tmo: MIMEType._Core(type: .application, tree: .vnd, subtype: "tmobile-livetv", suffix: nil),
-  .torrent: MIMEType._Core(type: .application, tree: nil, subtype: "x-bittorrent", suffix: nil),
-  .tpl: MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-tool-template", suffix: nil),
-  .tpt: MIMEType._Core(type: .application, tree: .vnd, subtype: "trid.tpt", suffix: nil),
-  .tr: MIMEType._Core(type: .text, tree: nil, subtype: "troff", suffix: nil),
-  .tra: MIMEType._Core(type: .application, tree: .vnd, subtype: "trueapp", suffix: nil),
-  .trm: MIMEType._Core(type: .application, tree: nil, subtype: "x-msterminal", suffix: nil),
-  .ts: MIMEType._Core(type: .video, tree: nil, subtype: "mp2t", suffix: nil),
-  .tsd: MIMEType._Core(type: .application, tree: nil, subtype: "timestamped-data", suffix: nil),
-  .tsv: MIMEType._Core(type: .text, tree: nil, subtype: "tab-separated-values", suffix: nil),
-  .ttc: MIMEType._Core(type: .font, tree: nil, subtype: "collection", suffix: nil),
-  .ttf: MIMEType._Core(type: .font, tree: nil, subtype: "ttf", suffix: nil),
-  .ttl: MIMEType._Core(type: .text, tree: nil, subtype: "turtle", suffix: nil),
-  .twd: MIMEType._Core(type: .application, tree: .vnd, subtype: "simtech-mindmapper", suffix: nil),
-  .twds: MIMEType._Core(type: .application, tree: .vnd, subtype: "simtech-mindmapper", suffix: nil),
-  .txd: MIMEType._Core(type: .application, tree: .vnd, subtype: "genomatix.tuxedo", suffix: nil),
-  .txf: MIMEType._Core(type: .application, tree: .vnd, subtype: "mobius.txf", suffix: nil),
-  .txt: MIMEType._Core(type: .text, tree: nil, subtype: "plain", suffix: nil),
-  .u32: MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-bin", suffix: nil),
-  .udeb: MIMEType._Core(type: .application, tree: nil, subtype: "x-debian-package", suffix: nil),
-  .ufd: MIMEType._Core(type: .application, tree: .vnd, subtype: "ufdl", suffix: nil),
-  .ufdl: MIMEType._Core(type: .application, tree: .vnd, subtype: "ufdl", suffix: nil),
-  .ulx: MIMEType._Core(type: .application, tree: nil, subtype: "x-glulx", suffix: nil),
-  .umj: MIMEType._Core(type: .application, tree: .vnd, subtype: "umajin", suffix: nil),
-  .unityweb: MIMEType._Core(type: .application, tree: .vnd, subtype: "unity", suffix: nil),
-  .uoml: MIMEType._Core(type: .application, tree: .vnd, subtype: "uoml", suffix: .xml),
-  .uri: MIMEType._Core(type: .text, tree: nil, subtype: "uri-list", suffix: nil),
-  .uris: MIMEType._Core(type: .text, tree: nil, subtype: "uri-list", suffix: nil),
-  .urls: MIMEType._Core(type: .text, tree: nil, subtype: "uri-list", suffix: nil),
-  .ustar: MIMEType._Core(type: .application, tree: nil, subtype: "x-ustar", suffix: nil),
-  .utz: MIMEType._Core(type: .application, tree: .vnd, subtype: "uiq.theme", suffix: nil),
-  .uu: MIMEType._Core(type: .text, tree: nil, subtype: "x-uuencode", suffix: nil),
-  .uva: MIMEType._Core(type: .audio, tree: .vnd, subtype: "dece.audio", suffix: nil),
-  .uvd: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.data", suffix: nil),
-  .uvf: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.data", suffix: nil),
-  .uvg: MIMEType._Core(type: .image, tree: .vnd, subtype: "dece.graphic", suffix: nil),
-  .uvh: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.hd", suffix: nil),
-  .uvi: MIMEType._Core(type: .image, tree: .vnd, subtype: "dece.graphic", suffix: nil),
-  .uvm: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.mobile", suffix: nil),
-  .uvp: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.pd", suffix: nil),
-  .uvs: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.sd", suffix: nil),
-  .uvt: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.ttml", suffix: .xml),
-  .uvu: MIMEType._Core(type: .video, tree: .vnd, subtype: "uvvu.mp4", suffix: nil),
-  .uvv: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.video", suffix: nil),
-  .uvva: MIMEType._Core(type: .audio, tree: .vnd, subtype: "dece.audio", suffix: nil),
-  .uvvd: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.data", suffix: nil),
-  .uvvf: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.data", suffix: nil),
-  .uvvg: MIMEType._Core(type: .image, tree: .vnd, subtype: "dece.graphic", suffix: nil),
-  .uvvh: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.hd", suffix: nil),
-  .uvvi: MIMEType._Core(type: .image, tree: .vnd, subtype: "dece.graphic", suffix: nil),
-  .uvvm: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.mobile", suffix: nil),
-  .uvvp: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.pd", suffix: nil),
-  .uvvs: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.sd", suffix: nil),
-  .uvvt: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.ttml", suffix: .xml),
-  .uvvu: MIMEType._Core(type: .video, tree: .vnd, subtype: "uvvu.mp4", suffix: nil),
-  .uvvv: MIMEType._Core(type: .video, tree: .vnd, subtype: "dece.video", suffix: nil),
-  .uvvx: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.unspecified", suffix: nil),
-  .uvvz: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.zip", suffix: nil),
-  .uvx: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.unspecified", suffix: nil),
-  .uvz: MIMEType._Core(type: .application, tree: .vnd, subtype: "dece.zip", suffix: nil),
-  .vcard: MIMEType._Core(type: .text, tree: nil, subtype: "vcard", suffix: nil),
-  .vcd: MIMEType._Core(type: .application, tree: nil, subtype: "x-cdlink", suffix: nil),
-  .vcf: MIMEType._Core(type: .text, tree: nil, subtype: "x-vcard", suffix: nil),
-  .vcg: MIMEType._Core(type: .application, tree: .vnd, subtype: "groove-vcard", suffix: nil),
-  .vcs: MIMEType._Core(type: .text, tree: nil, subtype: "x-vcalendar", suffix: nil),
-  .vcx: MIMEType._Core(type: .application, tree: .vnd, subtype: "vcx", suffix: nil),
-  .vis: MIMEType._Core(type: .application, tree: .vnd, subtype: "visionary", suffix: nil),
-  .viv: MIMEType._Core(type: .video, tree: .vnd, subtype: "vivo", suffix: nil),
-  .vob: MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-vob", suffix: nil),
-  .vor: MIMEType._Core(type: .application, tree: .vnd, subtype: "stardivision.writer", suffix: nil),
-  .vox: MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-bin", suffix: nil),
-  .vrml: MIMEType._Core(type: .model, tree: nil, subtype: "vrml", suffix: nil),
-  .vsd: MIMEType._Core(type: .application, tree: .vnd, subtype: "visio", suffix: nil),
-  .vsf: MIMEType._Core(type: .application, tree: .vnd, subtype: "vsf", suffix: nil),
-  .vss: MIMEType._Core(type: .application, tree: .vnd, subtype: "visio", suffix: nil),
-  .vst: MIMEType._Core(type: .application, tree: .vnd, subtype: "visio", suffix: nil),
-  .vsw: MIMEType._Core(type: .application, tree: .vnd, subtype: "visio", suffix: nil),
-  .vtu: MIMEType._Core(type: .model, tree: .vnd, subtype: "vtu", suffix: nil),
-  .vxml: MIMEType._Core(type: .application, tree: nil, subtype: "voicexml", suffix: .xml),
-  .w3d: MIMEType._Core(type: .application, tree: nil, subtype: "x-director", suffix: nil),
-  .wad: MIMEType._Core(type: .application, tree: nil, subtype: "x-doom", suffix: nil),
-  .wasm: MIMEType._Core(type: .application, tree: nil, subtype: "wasm", suffix: nil),
-  .wav: MIMEType._Core(type: .audio, tree: nil, subtype: "x-wav", suffix: nil),
-  .wax: MIMEType._Core(type: .audio, tree: nil, subtype: "x-ms-wax", suffix: nil),
-  .wbmp: MIMEType._Core(type: .image, tree: .vnd, subtype: "wap.wbmp", suffix: nil),
-  .wbs: MIMEType._Core(type: .application, tree: .vnd, subtype: "criticaltools.wbs", suffix: .xml),
-  .wbxml: MIMEType._Core(type: .application, tree: .vnd, subtype: "wap.wbxml", suffix: nil),
-  .wcm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-works", suffix: nil),
-  .wdb: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-works", suffix: nil),
-  .wdp: MIMEType._Core(type: .image, tree: .vnd, subtype: "ms-photo", suffix: nil),
-  .weba: MIMEType._Core(type: .audio, tree: nil, subtype: "webm", suffix: nil),
-  .webm: MIMEType._Core(type: .video, tree: nil, subtype: "webm", suffix: nil),
-  .webp: MIMEType._Core(type: .image, tree: nil, subtype: "webp", suffix: nil),
-  .wg: MIMEType._Core(type: .application, tree: .vnd, subtype: "pmi.widget", suffix: nil),
-  .wgt: MIMEType._Core(type: .application, tree: nil, subtype: "widget", suffix: nil),
-  .wks: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-works", suffix: nil),
-  .wm: MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wm", suffix: nil),
-  .wma: MIMEType._Core(type: .audio, tree: nil, subtype: "x-ms-wma", suffix: nil),
-  .wmd: MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-wmd", suffix: nil),
-  .wmf: MIMEType._Core(type: .application, tree: nil, subtype: "x-msmetafile", suffix: nil),
-  .wml: MIMEType._Core(type: .text, tree: .vnd, subtype: "wap.wml", suffix: nil),
-  .wmlc: MIMEType._Core(type: .application, tree: .vnd, subtype: "wap.wmlc", suffix: nil),
-  .wmls: MIMEType._Core(type: .text, tree: .vnd, subtype: "wap.wmlscript", suffix: nil),
-  .wmlsc: MIMEType._Core(type: .application, tree: .vnd, subtype: "wap.wmlscriptc", suffix: nil),
-  .wmv: MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wmv", suffix: nil),
-  .wmx: MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wmx", suffix: nil),
-  .wmz: MIMEType._Core(type: .application, tree: nil, subtype: "x-msmetafile", suffix: nil),
-  .woff: MIMEType._Core(type: .font, tree: nil, subtype: "woff", suffix: nil),
-  .woff2: MIMEType._Core(type: .font, tree: nil, subtype: "woff2", suffix: nil),
-  .wpd: MIMEType._Core(type: .application, tree: .vnd, subtype: "wordperfect", suffix: nil),
-  .wpl: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-wpl", suffix: nil),
-  .wps: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-works", suffix: nil),
-  .wqd: MIMEType._Core(type: .application, tree: .vnd, subtype: "wqd", suffix: nil),
-  .wri: MIMEType._Core(type: .application, tree: nil, subtype: "x-mswrite", suffix: nil),
-  .wrl: MIMEType._Core(type: .model, tree: nil, subtype: "vrml", suffix: nil),
-  .wsdl: MIMEType._Core(type: .application, tree: nil, subtype: "wsdl", suffix: .xml),
-  .wspolicy: MIMEType._Core(type: .application, tree: nil, subtype: "wspolicy", suffix: .xml),
-  .wtb: MIMEType._Core(type: .application, tree: .vnd, subtype: "webturbo", suffix: nil),
-  .wvx: MIMEType._Core(type: .video, tree: nil, subtype: "x-ms-wvx", suffix: nil),
-  .x32: MIMEType._Core(type: .application, tree: nil, subtype: "x-authorware-bin", suffix: nil),
-  .x3d: MIMEType._Core(type: .model, tree: nil, subtype: "x3d", suffix: .xml),
-  .x3db: MIMEType._Core(type: .model, tree: nil, subtype: "x3d+binary", suffix: nil),
-  .x3dbz: MIMEType._Core(type: .model, tree: nil, subtype: "x3d+binary", suffix: nil),
-  .x3dv: MIMEType._Core(type: .model, tree: nil, subtype: "x3d+vrml", suffix: nil),
-  .x3dvz: MIMEType._Core(type: .model, tree: nil, subtype: "x3d+vrml", suffix: nil),
-  .x3dz: MIMEType._Core(type: .model, tree: nil, subtype: "x3d", suffix: .xml),
-  .xaml: MIMEType._Core(type: .application, tree: nil, subtype: "xaml", suffix: .xml),
-  .xap: MIMEType._Core(type: .application, tree: nil, subtype: "x-silverlight-app", suffix: nil),
-  .xar: MIMEType._Core(type: .application, tree: .vnd, subtype: "xara", suffix: nil),
-  .xbap: MIMEType._Core(type: .application, tree: nil, subtype: "x-ms-xbap", suffix: nil),
-  .xbd: MIMEType._Core(type: .application, tree: .vnd, subtype: "fujixerox.docuworks.binder", suffix: nil),
-  .xbm: MIMEType._Core(type: .image, tree: nil, subtype: "x-xbitmap", suffix: nil),
-  .xdf: MIMEType._Core(type: .application, tree: nil, subtype: "xcap-diff", suffix: .xml),
-  .xdm: MIMEType._Core(type: .application, tree: .vnd, subtype: "syncml.dm", suffix: .xml),
-  .xdp: MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.xdp", suffix: .xml),
-  .xdssc: MIMEType._Core(type: .application, tree: nil, subtype: "dssc", suffix: .xml),
-  .xdw: MIMEType._Core(type: .application, tree: .vnd, subtype: "fujixerox.docuworks", suffix: nil),
-  .xenc: MIMEType._Core(type: .application, tree: nil, subtype: "xenc", suffix: .xml),
-  .xer: MIMEType._Core(type: .application, tree: nil, subtype: "patch-ops-error", suffix: .xml),
-  .xfdf: MIMEType._Core(type: .application, tree: .vnd, subtype: "adobe.xfdf", suffix: nil),
-  .xfdl: MIMEType._Core(type: .application, tree: .vnd, subtype: "xfdl", suffix: nil),
-  .xht: MIMEType._Core(type: .application, tree: nil, subtype: "xhtml", suffix: .xml),
-  .xhtml: MIMEType._Core(type: .application, tree: nil, subtype: "xhtml", suffix: .xml),
-  .xhvml: MIMEType._Core(type: .application, tree: nil, subtype: "xv", suffix: .xml),
-  .xif: MIMEType._Core(type: .image, tree: .vnd, subtype: "xiff", suffix: nil),
-  .xla: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel", suffix: nil),
-  .xlam: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.addin.macroenabled.12", suffix: nil),
-  .xlc: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel", suffix: nil),
-  .xlf: MIMEType._Core(type: .application, tree: nil, subtype: "x-xliff", suffix: .xml),
-  .xlm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel", suffix: nil),
-  .xls: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel", suffix: nil),
-  .xlsb: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.sheet.binary.macroenabled.12", suffix: nil),
-  .xlsm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.sheet.macroenabled.12", suffix: nil),
-  .xlsx: MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.spreadsheetml.sheet", suffix: nil),
-  .xlt: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel", suffix: nil),
-  .xltm: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel.template.macroenabled.12", suffix: nil),
-  .xltx: MIMEType._Core(type: .application, tree: .vnd, subtype: "openxmlformats-officedocument.spreadsheetml.template", suffix: nil),
-  .xlw: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-excel", suffix: nil),
-  .xm: MIMEType._Core(type: .audio, tree: nil, subtype: "xm", suffix: nil),
-  .xml: MIMEType._Core(type: .application, tree: nil, subtype: "xml", suffix: nil),
-  .xo: MIMEType._Core(type: .application, tree: .vnd, subtype: "olpc-sugar", suffix: nil),
-  .xop: MIMEType._Core(type: .application, tree: nil, subtype: "xop", suffix: .xml),
-  .xpi: MIMEType._Core(type: .application, tree: nil, subtype: "x-xpinstall", suffix: nil),
-  .xpl: MIMEType._Core(type: .application, tree: nil, subtype: "xproc", suffix: .xml),
-  .xpm: MIMEType._Core(type: .image, tree: nil, subtype: "x-xpixmap", suffix: nil),
-  .xpr: MIMEType._Core(type: .application, tree: .vnd, subtype: "is-xpr", suffix: nil),
-  .xps: MIMEType._Core(type: .application, tree: .vnd, subtype: "ms-xpsdocument", suffix: nil),
-  .xpw: MIMEType._Core(type: .application, tree: .vnd, subtype: "intercon.formnet", suffix: nil),
-  .xpx: MIMEType._Core(type: .application, tree: .vnd, subtype: "intercon.formnet", suffix: nil),
-  .xsl: MIMEType._Core(type: .application, tree: nil, subtype: "xml", suffix: nil),
-  .xslt: MIMEType._Core(type: .application, tree: nil, subtype: "xslt", suffix: .xml),
-  .xsm: MIMEType._Core(type: .application, tree: .vnd, subtype: "syncml", suffix: .xml),
-  .xspf: MIMEType._Core(type: .application, tree: nil, subtype: "xspf", suffix: .xml),
-  .xul: MIMEType._Core(type: .application, tree: .vnd, subtype: "mozilla.xul", suffix: .xml),
-  .xvm: MIMEType._Core(type: .application, tree: nil, subtype: "xv", suffix: .xml),
-  .xvml: MIMEType._Core(type: .application, tree: nil, subtype: "xv", suffix: .xml),
-  .xwd: MIMEType._Core(type: .image, tree: nil, subtype: "x-xwindowdump", suffix: nil),
-  .xyz: MIMEType._Core(type: .chemical, tree: nil, subtype: "x-xyz", suffix: nil),
-  .xz: MIMEType._Core(type: .application, tree: nil, subtype: "x-xz", suffix: nil),
-  .yang: MIMEType._Core(type: .application, tree: nil, subtype: "yang", suffix: nil),
-  .yin: MIMEType._Core(type: .application, tree: nil, subtype: "yin", suffix: .xml),
-  .z1: MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil),
-  .z2: MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil),
-  .z3: MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil),
-  .z4: MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil),
-  .z5: MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil),
-  .z6: MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil),
-  .z7: MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil),
-  .z8: MIMEType._Core(type: .application, tree: nil, subtype: "x-zmachine", suffix: nil),
-  .zaz: MIMEType._Core(type: .application, tree: .vnd, subtype: "zzazz.deck", suffix: .xml),
-  .zip: MIMEType._Core(type: .application, tree: nil, subtype: "zip", suffix: nil),
-  .zir: MIMEType._Core(type: .application, tree: .vnd, subtype: "zul", suffix: nil),
-  .zirz: MIMEType._Core(type: .application, tree: .vnd, subtype: "zul", suffix: nil),
-  .zmm: MIMEType._Core(type: .application, tree: .vnd, subtype: "handheld-entertainment", suffix: .xml),
+
+internal let _internedMIMETypeHashDisplacements: [UInt32] = [
+  0, 10, 1, 1, 0, 0, 14, 1, 0, 0, 2, 5, 1, 0, 0, 4,
+  1, 9, 2, 1, 7, 1, 1, 0, 0, 2, 0, 0, 4, 1, 5, 0,
+  0, 8, 0, 0, 1, 0, 1, 0, 4, 7, 5, 4, 7, 2, 0, 3,
+  1, 5, 10, 0, 0, 3, 17, 1, 1, 0, 2, 22, 0, 2, 6, 6,
+  1, 12, 1, 3, 0, 28, 1, 13, 10, 9, 0, 4, 2, 25, 0, 1,
+  10, 1, 4, 4, 10, 0, 0, 2, 5, 5, 10, 0, 0, 0, 14, 3,
+  6, 3, 1, 8, 33, 2, 3, 7, 3, 0, 8, 13, 5, 9, 2, 2,
+  5, 5, 0, 0, 0, 31, 3, 4, 6, 11, 6, 15, 0, 0, 42, 2,
+  3, 2, 10, 0, 0, 10, 9, 0, 0, 11, 1, 0, 13, 1, 4, 5,
+  0, 6, 8, 54, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1,
+  6, 3, 8, 3, 2, 18, 9, 2, 1, 2, 4, 1, 1, 0, 1, 0,
+  0, 7, 0, 0, 0, 1, 0, 2, 0, 13, 15, 8, 1, 5, 3, 9,
+  8, 9, 19, 0, 2, 0, 2, 15, 2, 7, 0, 3, 4, 9, 1, 7,
+  11, 6, 4, 9, 0, 0, 2, 2, 19, 7, 4, 0, 7, 2, 10, 3,
+  14, 5, 9, 13, 12, 1, 14, 17, 0, 16, 47, 13, 0, 1, 0, 0,
+  78, 0, 5, 1, 2, 2, 0, 0, 2, 8, 0, 0, 4, 0, 3, 108,
+  1, 29, 0, 1, 0, 0, 11, 31, 0, 12, 0, 48, 54, 20, 10, 10,
+  1, 10, 4, 7, 10, 4, 8, 4, 1, 0, 6, 1, 33, 9, 25, 8,
+  2, 2, 23, 35, 42, 2, 0, 0, 2, 26, 21, 11, 7, 4, 3, 5,
+  24, 9, 7, 14, 18, 64, 16, 0, 1, 38, 49, 0, 31, 28, 2, 20,
+  1, 1, 102, 7, 0, 38, 12, 32, 0, 5, 59, 11, 144, 16, 7, 32,
+  11, 2, 39, 6, 48, 68, 9, 40, 0, 52, 61, 3, 136, 0, 0, 20,
+  0, 15, 48, 23, 182, 0, 11, 0, 253, 0, 19, 44, 127, 45, 0, 110,
+  1, 0, 52, 8, 6, 0, 29, 343, 11, 0, 248, 440, 31, 0, 2544, 48,
+  3,
+]
+
+internal let _internedMIMETypeHashSlots: [UInt16] = [
+  433, 80, 657, 263, 147, 640, 758, 684, 430, 316, 219, 304, 239, 184, 557, 111,
+  695, 716, 752, 71, 535, 625, 729, 432, 325, 631, 182, 546, 394, 493, 378, 578,
+  608, 200, 417, 532, 349, 628, 741, 585, 594, 222, 185, 679, 454, 591, 38, 45,
+  412, 616, 319, 235, 606, 727, 500, 179, 122, 750, 490, 586, 242, 498, 494, 240,
+  311, 5, 730, 18, 647, 345, 654, 373, 552, 29, 404, 252, 443, 266, 19, 214,
+  272, 139, 313, 457, 81, 288, 172, 138, 224, 414, 186, 73, 477, 259, 251, 261,
+  416, 544, 601, 166, 137, 403, 714, 3, 42, 298, 279, 517, 25, 435, 732, 211,
+  230, 207, 31, 241, 452, 434, 486, 746, 380, 420, 334, 329, 573, 383, 321, 478,
+  724, 196, 482, 165, 540, 508, 290, 197, 733, 44, 759, 336, 296, 102, 74, 592,
+  315, 202, 300, 644, 598, 689, 661, 77, 509, 277, 338, 614, 660, 281, 162, 460,
+  355, 84, 736, 154, 651, 369, 513, 328, 340, 33, 359, 63, 537, 718, 99, 68,
+  437, 374, 127, 347, 451, 683, 9, 514, 144, 728, 531, 12, 346, 299, 246, 690,
+  106, 136, 662, 150, 471, 32, 309, 183, 51, 424, 401, 699, 715, 643, 526, 205,
+  275, 379, 178, 353, 570, 120, 492, 173, 62, 734, 85, 582, 580, 577, 550, 381,
+  701, 64, 156, 458, 306, 167, 107, 145, 318, 28, 256, 439, 337, 193, 607, 269,
+  348, 217, 135, 611, 751, 371, 641, 198, 40, 723, 440, 431, 410, 237, 421, 556,
+  506, 92, 114, 60, 208, 543, 276, 767, 551, 503, 320, 265, 52, 464, 402, 141,
+  712, 448, 210, 255, 569, 20, 169, 370, 604, 229, 247, 639, 390, 626, 646, 34,
+  119, 164, 310, 69, 57, 233, 67, 618, 187, 215, 527, 393, 754, 354, 192, 376,
+  89, 467, 249, 496, 30, 638, 590, 674, 721, 396, 324, 542, 426, 561, 158, 468,
+  738, 571, 558, 155, 635, 377, 212, 362, 518, 708, 700, 745, 519, 502, 332, 621,
+  226, 39, 560, 146, 483, 104, 14, 70, 450, 339, 15, 769, 148, 35, 189, 749,
+  757, 495, 234, 449, 623, 177, 286, 1, 645, 566, 301, 538, 408, 168, 703, 352,
+  676, 96, 459, 704, 456, 53, 253, 479, 218, 58, 82, 597, 225, 760, 669, 382,
+  670, 559, 648, 480, 655, 743, 295, 627, 273, 744, 90, 688, 696, 283, 667, 204,
+  568, 206, 357, 113, 761, 391, 10, 497, 292, 507, 685, 748, 335, 418, 171, 709,
+  488, 484, 666, 116, 675, 756, 372, 529, 652, 694, 227, 36, 128, 130, 706, 587,
+  650, 658, 668, 663, 600, 395, 278, 510, 673, 250, 213, 375, 101, 13, 445, 405,
+  530, 232, 161, 236, 131, 520, 43, 223, 8, 472, 596, 672, 124, 194, 78, 221,
+  118, 176, 680, 351, 474, 713, 523, 41, 17, 97, 132, 624, 475, 231, 289, 636,
+  707, 47, 581, 574, 284, 103, 366, 91, 363, 323, 364, 603, 268, 547, 455, 50,
+  109, 686, 711, 462, 768, 629, 720, 742, 201, 388, 87, 705, 216, 75, 397, 100,
+  613, 72, 297, 595, 400, 55, 753, 254, 79, 398, 23, 248, 280, 331, 637, 525,
+  220, 691, 740, 762, 423, 392, 428, 267, 501, 427, 305, 341, 533, 244, 665, 308,
+  293, 693, 384, 342, 564, 2, 117, 731, 622, 747, 593, 522, 473, 725, 108, 385,
+  56, 565, 583, 659, 465, 589, 634, 360, 285, 16, 737, 368, 387, 615, 66, 429,
+  333, 649, 133, 326, 470, 48, 365, 389, 282, 671, 524, 163, 735, 539, 411, 461,
+  26, 21, 549, 46, 152, 110, 722, 515, 436, 633, 7, 129, 739, 93, 548, 350,
+  528, 199, 575, 710, 203, 228, 327, 697, 656, 358, 534, 687, 54, 489, 302, 516,
+  83, 27, 11, 521, 678, 134, 406, 442, 563, 307, 553, 303, 438, 567, 698, 511,
+  125, 545, 425, 264, 322, 160, 642, 175, 599, 446, 605, 463, 512, 170, 536, 407,
+  257, 572, 59, 245, 180, 95, 188, 717, 409, 6, 356, 330, 143, 361, 602, 617,
+  765, 719, 487, 491, 504, 681, 312, 98, 343, 105, 476, 174, 258, 4, 499, 149,
+  274, 579, 466, 195, 620, 291, 653, 86, 65, 692, 682, 115, 0, 88, 76, 142,
+  541, 94, 419, 287, 367, 664, 121, 49, 554, 453, 191, 469, 764, 584, 271, 562,
+  24, 314, 181, 157, 630, 612, 61, 619, 190, 677, 159, 344, 238, 123, 444, 140,
+  399, 555, 413, 726, 422, 632, 481, 610, 415, 441, 153, 505, 260, 588, 763, 485,
+  447, 766, 317, 37, 294, 576, 702, 386, 151, 209, 609, 755, 126, 270, 243, 112,
+  262, 22,
+]
+
+internal let _pathExtensionHashDisplacements: [UInt32] = [
+  0, 0, 0, 12, 8, 0, 0, 3, 262, 74, 0, 0, 0, 0, 0, 0,
+  0, 26, 33, 0, 1, 0, 0, 21, 1069, 148, 0, 0, 0, 11, 0, 0,
+  0, 0, 42, 16, 6, 0, 0, 148, 0, 8335, 0, 0, 11, 19, 0, 39,
+  0, 0, 30, 0, 26, 0, 19, 1, 45, 22316, 0, 0, 0, 0, 0, 0,
+  0, 0, 28, 0, 0, 0, 0, 8, 169, 71, 0, 0, 3, 0, 1, 0,
+  0, 15, 2, 0, 0, 0, 30, 42, 0, 358, 0, 0, 0, 21, 0, 0,
+  0, 0, 0, 1, 0, 0, 0, 2, 16, 5, 0, 0, 0, 0, 16, 0,
+  0, 22, 3, 0, 12, 0, 6, 38, 531, 29, 0, 0, 0, 0, 131, 0,
+  0, 0, 50, 0, 11, 0, 0, 5, 98, 41, 12, 0, 0, 47, 0, 18,
+  0, 10, 12, 7, 23, 0, 11, 0, 497, 3, 0, 0, 0, 0, 12, 6,
+  13, 0, 4, 0, 8, 0, 0, 85, 0, 5, 0, 74, 0, 12, 0, 0,
+  10, 0, 0, 0, 305, 14, 0, 0, 46, 13, 0, 46, 22, 0, 10, 27,
+  0, 76, 0, 0, 65, 0, 0, 51, 8, 16, 6, 0, 9, 8, 6, 0,
+  0, 34, 4, 0, 17, 16, 0, 79, 434, 735, 0, 0, 0, 0, 0, 0,
+  31, 28, 0, 0, 24, 0, 0, 39, 353, 5935, 0, 0, 0, 0, 40, 0,
+  0, 14, 18, 1, 32, 0, 62, 140, 165, 7496, 0, 12, 0, 40, 6, 0,
+  5, 59, 16, 8, 5, 0, 0, 4, 29, 941, 0, 0, 0, 0, 0, 0,
+  0, 0, 45, 32, 37, 0, 14, 5, 46, 1, 0, 0, 0, 0, 0, 13,
+  45, 0, 0, 0, 0, 25, 0, 23, 115, 7286, 0, 0, 2, 0, 0, 0,
+  0, 13, 0, 0, 51, 0, 31, 91, 795, 2573, 0, 33, 0, 6, 0, 38,
+  0, 0, 91, 13, 224, 0, 19, 28, 138, 1691, 12, 0, 0, 0, 90, 0,
+  0, 0, 0, 0, 0, 0, 0, 23, 53, 110, 0, 0, 7, 0, 11, 19,
+  13, 0, 7, 40, 19, 1, 0, 29, 4, 218, 25, 0, 0, 21, 0, 0,
+  0, 0, 0, 0, 21, 12, 0, 22, 1501, 1241, 0, 0, 14, 0, 0, 0,
+  108, 0, 17, 0, 128, 2, 0, 0, 494, 14241, 0, 41, 0, 0, 0, 0,
+  0, 0, 28, 0, 91, 32, 2, 80, 12, 10081, 0, 0, 2, 0, 0, 0,
+  0, 0, 93, 0, 107, 12, 0, 14, 220, 0, 0, 0, 0, 0, 0, 0,
+  70, 0, 0, 0, 11, 81, 0, 73, 353, 5776, 0, 0, 17, 29, 0, 121,
+  2, 124, 0, 0, 0, 0, 119, 68, 128, 503, 0, 0, 37, 0, 0, 0,
+  0, 315, 0, 0, 192, 0, 162, 74, 300, 35534, 0, 0, 0, 0, 0, 0,
+  0, 29, 57, 111, 34, 0, 670, 626, 0, 1649, 102, 11, 0, 225, 0, 1326,
+]
+
+internal let _pathExtensionHashSlots: [MIMEType.PathExtension] = [
+  .wgt,
+  .xenc,
+  .wav,
+  .mxu,
+  .hpid,
+  .qfx,
+  .mxf,
+  .mwf,
+  .xo,
+  .x3dv,
+  .slt,
+  .htm,
+  .roa,
+  .opus,
+  .ma,
+  .dxp,
+  .tpl,
+  .xar,
+  .stl,
+  .vis,
+  .cc,
+  .f4v,
+  .mqy,
+  .tfi,
+  .c4u,
+  .ez3,
+  .m1v,
+  .pnm,
+  .apr,
+  .ez,
+  .pfx,
+  .ppm,
+  .mp2,
+  .dssc,
+  .xz,
+  .otg,
+  .dcr,
+  .wsdl,
+  .maker,
+  .csh,
+  .qt,
+  .`in`,
+  .ots,
+  .trm,
+  .blb,
+  .pps,
+  .oas,
+  .ott,
+  .pki,
+  .ssdl,
+  .aw,
+  .dae,
+  .ghf,
+  .skt,
+  .abw,
+  .sgl,
+  .stf,
+  .bdm,
+  .pcap,
+  .sisx,
+  .icc,
+  .unityweb,
+  .dot,
+  .dmg,
+  .btif,
+  .dcurl,
+  .kia,
+  .xpl,
+  .uvvd,
+  .mkv,
+  .kfo,
+  .opf,
+  .mrc,
+  .les,
+  .csv,
+  .gif,
+  .spot,
+  .xif,
+  .pyv,
+  .uvvx,
+  .rpst,
+  .wmlsc,
+  .asf,
+  .odc,
+  .snf,
+  .mmd,
+  .zirz,
+  .mk3d,
+  .woff2,
+  .hpgl,
+  .bz2,
+  .clkk,
+  .elc,
+  .sit,
+  .jpg,
+  .vcs,
+  .svd,
+  .mads,
+  .mcurl,
+  .fh5,
+  .boz,
+  .ifb,
+  .svgz,
+  .exi,
+  .msh,
+  .rp9,
+  .pub,
+  .qxt,
+  .mp4s,
+  .sig,
+  .musicxml,
+  .dic,
+  .dxr,
+  .ait,
+  .me,
+  .nnd,
+  .gre,
+  .lnk,
+  .mdb,
+  .pclxl,
+  .otc,
+  .efif,
+  .azw,
+  .karbon,
+  .p7s,
+  .mp3,
+  .xltm,
+  .cdx,
+  .air,
+  .atomcat,
+  .vox,
+  .ext,
+  .i2g,
+  .cpio,
+  .mj2,
+  .tif,
+  .chm,
+  .midi,
+  .pcx,
+  .acc,
+  .potx,
+  .pgp,
+  .ipfix,
+  .msl,
+  .m14,
+  .sv4crc,
+  .sti,
+  .blorb,
+  .m2v,
+  .str,
+  ._7z,
+  .xfdl,
+  .sm,
+  .qbo,
+  .msf,
+  .n3,
+  .exe,
+  .xlm,
+  .m13,
+  .edx,
+  .bz,
+  .ktx,
+  .deb,
+  .pls,
+  .djv,
+  .docm,
+  .c11amc,
+  .pgn,
+  .fh,
+  .dotm,
+  .smzip,
+  .psd,
+  .h,
+  .hvd,
+  .cml,
+  .uris,
+  .emma,
+  .link66,
+  .ltf,
+  .aas,
+  .m4v,
+  .nbp,
+  .pdb,
+  .djvu,
+  .dfac,
+  .flac,
+  .vtu,
+  .gxf,
+  .m3u,
+  .ulx,
+  .stc,
+  .dart,
+  .pfm,
+  .ttl,
+  .fnc,
+  .gbr,
+  .pvb,
+  .qps,
+  .ogx,
+  .dvb,
+  .lha,
+  .plb,
+  .odb,
+  .cla,
+  .ez2,
+  .edm,
+  .rss,
+  .rep,
+  .et3,
+  .rld,
+  .mpp,
+  .cmp,
+  .ei6,
+  .wvx,
+  .viv,
+  .com,
+  .xpi,
+  .mpkg,
+  .jnlp,
+  .p,
+  .tcl,
+  .dis,
+  .xslt,
+  .mime,
+  .emf,
+  .sv4cpio,
+  .cdf,
+  .spf,
+  .dxf,
+  .pskcxml,
+  .xap,
+  .ggs,
+  .sda,
+  .bat,
+  .list3820,
+  .omdoc,
+  .f77,
+  .vor,
+  .flx,
+  .vcard,
+  .flo,
+  .htke,
+  .ivp,
+  .kne,
+  .wmx,
+  .ods,
+  .tcap,
+  .xdm,
+  .mka,
+  .jpe,
+  .wma,
+  .ccxml,
+  .z5,
+  .clkt,
+  .ts,
+  .jlt,
+  .webp,
+  .otf,
+  .rm,
+  .potm,
+  .crt,
+  .gramps,
+  .xls,
+  .skp,
+  .jsonml,
+  .cu,
+  .cii,
+  .mfm,
+  .cfs,
+  .eml,
+  .sdd,
+  .xps,
+  .ggb,
+  .ifm,
+  .wad,
+  .ufd,
+  .sub,
+  .pfa,
+  .acu,
+  .skm,
+  .pbm,
+  .scq,
+  .x3dz,
+  .dtd,
+  .ttc,
+  .tfm,
+  .psf,
+  .box,
+  .pic,
+  .uvs,
+  .shar,
+  .wdb,
+  .std,
+  .crl,
+  .cryptonote,
+  .ptid,
+  .wpd,
+  .uvva,
+  .fcs,
+  .z2,
+  .ser,
+  .xlw,
+  .cdxml,
+  .hdf,
+  .aso,
+  .odm,
+  .cdmia,
+  .smf,
+  .dms,
+  .wqd,
+  .ttf,
+  .yang,
+  .lbd,
+  .sxi,
+  .flv,
+  .bmp,
+  .stw,
+  .stk,
+  .qam,
+  .w3d,
+  .jxl,
+  .xul,
+  .m3a,
+  .pfr,
+  .torrent,
+  .ami,
+  .xlf,
+  .txf,
+  .ras,
+  .bh2,
+  .odp,
+  .thmx,
+  .pptm,
+  .etx,
+  .rar,
+  .au,
+  .xfdf,
+  .taglet,
+  .m3u8,
+  .ipk,
+  .mdi,
+  .iif,
+  .aam,
+  .cba,
+  .see,
+  .uvm,
+  .c4f,
+  .nfo,
+  .dotx,
+  .msty,
+  .aep,
+  .atomsvc,
+  .ddd,
+  .sitx,
+  .mseed,
+  .conf,
+  .cst,
+  .rdz,
+  .gml,
+  .curl,
+  .lbe,
+  .plc,
+  .uvvz,
+  .atom,
+  .ngdat,
+  .xla,
+  .svc,
+  .pya,
+  .mscml,
+  .gsf,
+  .sfdHdstx,
+  .sxg,
+  .smil,
+  .lzh,
+  .irp,
+  .csp,
+  .uvx,
+  .oprc,
+  .eva,
+  .mmr,
+  .uri,
+  .tex,
+  .xhvml,
+  .atc,
+  .fbs,
+  .mpeg,
+  .vss,
+  .mets,
+  .xyz,
+  .ustar,
+  .dist,
+  .pas,
+  .kpxx,
+  .urls,
+  .tei,
+  .swi,
+  .uvd,
+  .hh,
+  .xpw,
+  .pwn,
+  .nsc,
+  .rgb,
+  .xvm,
+  .cxx,
+  .pml,
+  .lrm,
+  .txd,
+  .xaml,
+  .ris,
+  .scs,
+  .uvvv,
+  .g3,
+  .mid,
+  .src,
+  .pcl,
+  .xml,
+  .dgc,
+  .texinfo,
+  .tr,
+  .uvvp,
+  .mus,
+  .txt,
+  .mp4v,
+  .sse,
+  .tsv,
+  .setreg,
+  .iso,
+  .qxl,
+  .cbr,
+  .rdf,
+  .teicorpus,
+  .wtb,
+  .fzs,
+  .x3d,
+  .dpg,
+  .c11amz,
+  .sema,
+  .irm,
+  .dll,
+  .odt,
+  .oti,
+  .nzb,
+  .rlc,
+  .tra,
+  .mxs,
+  .gdl,
+  .jar,
+  .wml,
+  .pkipath,
+  .xlam,
+  .u32,
+  .cpt,
+  .esf,
+  .z8,
+  .prf,
+  .srx,
+  .movie,
+  .iges,
+  .mbox,
+  .skd,
+  .semf,
+  .mrcx,
+  .prc,
+  .pgm,
+  .mpg,
+  .uva,
+  .oda,
+  .xbap,
+  .mgz,
+  .mpt,
+  .res,
+  .mb,
+  .sfs,
+  .wps,
+  .ppam,
+  .fdf,
+  .mpg4,
+  .webm,
+  .emz,
+  .mpn,
+  .mobi,
+  .igs,
+  .wspolicy,
+  .gram,
+  .zmm,
+  .kar,
+  .xlt,
+  .osf,
+  .ims,
+  .z6,
+  .spp,
+  .cdkey,
+  .f,
+  .hvs,
+  .pre,
+  .log,
+  .uvvu,
+  .uvvh,
+  .adp,
+  .asc,
+  .ics,
+  .sis,
+  .latex,
+  .sql,
+  .evy,
+  .mpc,
+  .spc,
+  .itp,
+  .cap,
+  .p7m,
+  .application,
+  .text,
+  .bcpio,
+  .m2t,
+  .clp,
+  .lostxml,
+  .jad,
+  .fsc,
+  .wks,
+  .ram,
+  .bed,
+  .asx,
+  .ivu,
+  .mag,
+  .oxt,
+  .iota,
+  .oga,
+  .woff,
+  .kon,
+  .fti,
+  .z3,
+  .kwd,
+  .dna,
+  .vcx,
+  .wcm,
+  .tao,
+  .mmf,
+  .lvp,
+  .wpl,
+  .twd,
+  .zaz,
+  .wmlc,
+  .der,
+  .cmdf,
+  .org,
+  .fh7,
+  .wbmp,
+  .mods,
+  .nGage,
+  .ssml,
+  .nml,
+  .hqx,
+  .smv,
+  .esa,
+  .eol,
+  .`class`,
+  .uvvs,
+  .so,
+  .otp,
+  .sid,
+  .fm,
+  .gca,
+  .x3dvz,
+  .sgi,
+  .aiff,
+  .gmx,
+  .pptx,
+  .asm,
+  .doc,
+  .html,
+  .pot,
+  .fgd,
+  .scd,
+  .cdy,
+  .xdssc,
+  .gv,
+  .sdc,
+  .yin,
+  .ico,
+  .joda,
+  .onetoc2,
+  .cgm,
+  .rif,
+  .pcurl,
+  .wm,
+  .dump,
+  .ecma,
+  .mjp2,
+  .knp,
+  .vsf,
+  .st,
+  .cer,
+  .dtshd,
+  .grxml,
+  .swa,
+  .wdp,
+  .xop,
+  .afm,
+  .fst,
+  .geo,
+  .ogg,
+  .scurl,
+  .`for`,
+  .cbt,
+  .pcf,
+  .dra,
+  .wri,
+  .vsw,
+  .fly,
+  .rip,
+  .sfv,
+  .mvb,
+  .zip,
+  .spx,
+  .g2w,
+  .gpx,
+  .jpgv,
+  .wmz,
+  .cbz,
+  .uvp,
+  .ogv,
+  .metalink,
+  .odf,
+  .es3,
+  .ecelp9600,
+  .arc,
+  .svg,
+  .xer,
+  .docx,
+  .afp,
+  .cdbcmsg,
+  .distz,
+  .plf,
+  .vxml,
+  .lasxml,
+  .onetmp,
+  .appcache,
+  .xsl,
+  .uvh,
+  .tga,
+  .rpss,
+  ._3g2,
+  .mif,
+  .cmc,
+  .gex,
+  .def,
+  .wmd,
+  .shf,
+  .m2a,
+  .gac,
+  .install,
+  .uu,
+  .frame,
+  .nnw,
+  ._3ds,
+  .cb7,
+  .swf,
+  .davmount,
+  .uvvf,
+  .eot,
+  .ace,
+  .dir,
+  .ra,
+  .dbk,
+  .xhtml,
+  .xlsx,
+  .qxb,
+  .xwd,
+  .wbxml,
+  .cat,
+  .odi,
+  .mlp,
+  .kmz,
+  .jisp,
+  .sus,
+  .rtx,
+  .uvvm,
+  .vst,
+  .ai,
+  .spq,
+  .bmi,
+  .css,
+  .gxt,
+  .rms,
+  .umj,
+  .uvvg,
+  .mpm,
+  .hal,
+  .atx,
+  .crd,
+  .npx,
+  .tiff,
+  .pkg,
+  .sxw,
+  .mxml,
+  .xpx,
+  .vob,
+  .mp21,
+  .xlc,
+  .sldx,
+  .dts,
+  .s,
+  .smi,
+  .paw,
+  .osfpvg,
+  .ahead,
+  .onepkg,
+  .rq,
+  .msi,
+  .texi,
+  .gnumeric,
+  .chrt,
+  .bin,
+  .vcd,
+  .cil,
+  .sil,
+  .cdmic,
+  .oa3,
+  .tar,
+  .gam,
+  .xbd,
+  .igm,
+  .odft,
+  .kpr,
+  .meta4,
+  .uvvt,
+  .mts,
+  .aac,
+  .wrl,
+  .xdp,
+  .oth,
+  .c,
+  .dataless,
+  .t,
+  .s3m,
+  .mpe,
+  .pfb,
+  .caf,
+  .book,
+  .ntf,
+  .wbs,
+  .x3db,
+  .lwp,
+  .imp,
+  .p7c,
+  .flw,
+  .onetoc,
+  .grv,
+  .kpt,
+  .srt,
+  .wmf,
+  .xdw,
+  .mathml,
+  .ief,
+  .xvml,
+  .ssf,
+  .oxps,
+  .rs,
+  .png,
+  .inkml,
+  .hlp,
+  .nns,
+  .gph,
+  .h264,
+  .mp2a,
+  .ps,
+  .pbd,
+  .igl,
+  .wmls,
+  .rnc,
+  .xm,
+  .m2ts,
+  .m4a,
+  .tpt,
+  .x32,
+  .sgm,
+  .aif,
+  .gtw,
+  .dsc,
+  .cpp,
+  .fig,
+  .psb,
+  .icm,
+  .mks,
+  .ktz,
+  .nlu,
+  .list,
+  .spl,
+  .apk,
+  .jpgm,
+  .hbci,
+  .uvu,
+  .mpy,
+  .uvf,
+  .avif,
+  .gim,
+  .feLaunch,
+  .ksp,
+  .sxm,
+  .dwg,
+  .vrml,
+  .ppsx,
+  .xbm,
+  .clkp,
+  .ufdl,
+  .p10,
+  .gtm,
+  .dmp,
+  .fh4,
+  .bpk,
+  .cmx,
+  .listafp,
+  .ggt,
+  .js,
+  .z7,
+  .p12,
+  .xpm,
+  .mbk,
+  .fhc,
+  .mc1,
+  .uvvi,
+  .sh,
+  .p7b,
+  .mjs,
+  .jam,
+  .gtar,
+  .p8,
+  .ink,
+  .portpkg,
+  .mp4,
+  .sgml,
+  .mov,
+  .xdf,
+  .ecelp4800,
+  .epub,
+  .lrf,
+  .dtb,
+  .sdp,
+  .wax,
+  .rmvb,
+  .dwf,
+  .udeb,
+  .setpay,
+  .twds,
+  .weba,
+  .pct,
+  .rl,
+  .obd,
+  .seed,
+  .ncx,
+  .ms,
+  .cct,
+  .vcg,
+  .clkw,
+  ._123,
+  .java,
+  .mar,
+  .fxpl,
+  .azs,
+  .c4p,
+  .nitf,
+  .ac,
+  .obj,
+  .p7r,
+  .xltx,
+  .wg,
+  .cww,
+  .bdf,
+  .x3dbz,
+  .cod,
+  .cab,
+  .mny,
+  .sxd,
+  .teacher,
+  .vsd,
+  .deploy,
+  .ppd,
+  .fvt,
+  .mesh,
+  .m21,
+  .daf,
+  .nb,
+  .dvi,
+  .gqs,
+  .xspf,
+  .wasm,
+  .car,
+  .c4d,
+  .h263,
+  .h261,
+  .cdmiq,
+  .rsd,
+  .z1,
+  .qwd,
+  .qwt,
+  .fg5,
+  .ppt,
+  .ktr,
+  .xpr,
+  .mgp,
+  .f90,
+  .csml,
+  .mft,
+  .jpm,
+  .silo,
+  .cxt,
+  .xsm,
+  ._3dml,
+  .rmi,
+  .zir,
+  .acutc,
+  .mxl,
+  .c4g,
+  .xlsm,
+  .oa2,
+  .sdkd,
+  .fcdt,
+  .man,
+  .cdmid,
+  .dp,
+  .uvv,
+  .m4u,
+  .fpx,
+  .chat,
+  .uvz,
+  .sldm,
+  .g3w,
+  .clkx,
+  .dd2,
+  .odg,
+  .wmv,
+  .xlsb,
+  .fli,
+  .mseq,
+  .json,
+  .azf,
+  .jpeg,
+  .saf,
+  .snd,
+  .rcprofile,
+  .kml,
+  .xht,
+  .sdw,
+  .uvg,
+  .gqf,
+  .mcd,
+  .pdf,
+  .uoml,
+  .aifc,
+  .opml,
+  .fxp,
+  .cdmio,
+  .kwt,
+  .hps,
+  .hvp,
+  .eps,
+  .nsf,
+  .ppsm,
+  .susp,
+  .sc,
+  .sru,
+  .cif,
+  .igx,
+  .qxd,
+  .uvi,
+  .avi,
+  .nc,
+  .sxc,
+  .uvt,
+  .rmp,
+  .rtf,
+  .ecelp7470,
+  .z4,
+  .tsd,
+  .mpga,
+  .aab,
+  .tmo,
+  .pqa,
+  .sbml,
+  .scm,
+  .mp4a,
+  .mie,
+  .semd,
+  .t3,
+  ._3gp,
+  .sdkm,
+  .vcf,
+  .roff,
+  .mng,
+  .ftc,
+  .utz,
 ]
@@ -107,7 +107,35 @@ public struct MIMEType: Sendable {
     }
   }
   
-  internal var _core: _Core
+  /// Storage of `_Core`.
+  /// MIME types listed in "MIMEType+PathExtension.swift" are always represented by their IDs.
+  internal enum _Storage: Sendable {
+    case interned(UInt16)
+    case core(_Core)
+    
+    internal init(_ core: _Core) {
+      if let id = core._internedID {
+        self = .interned(id)
+      } else {
+        self = .core(core)
+      }
+    }
+  }
+
+  internal var _storage: _Storage
+  internal var _core: _Core {
+    get {
+      switch self._storage {
+      case .interned(let id):
+        return _internedMIMETypeCores[Int(id)]
+      case .core(let core):
+        return core
+      }
+    }
+    set {
+      self._storage = _Storage(newValue)
+    }
+  }
   public var type: TopLevelType {
     get { return self._core._type }
     set { self._core._type = newValue }
@@ -141,7 +169,12 @@ public struct MIMEType: Sendable {
   }
   
   internal init?(core:_Core, parameters:Parameters?) {
-    self._core = core
+    self._storage = _Storage(core)
+    self.parameters = parameters
+  }
+  
+  internal init?(internedID:UInt16, parameters:Parameters?) {
+    self._storage = .interned(internedID)
     self.parameters = parameters
   }
   
@@ -158,11 +191,25 @@ public struct MIMEType: Sendable {
 
 extension MIMEType: Hashable {
   public static func ==(lhs:MIMEType, rhs:MIMEType) -> Bool {
-    return lhs._core == rhs._core && lhs._parameters == rhs._parameters
+    guard lhs._parameters == rhs._parameters else { return false }
+    // A MIME type that can be interned is never stored as `.core`.
+    switch (lhs._storage, rhs._storage) {
+    case (.interned(let lID), .interned(let rID)):
+      return lID == rID
+    case (.core(let lCore), .core(let rCore)):
+      return lCore == rCore
+    default:
+      return false
+    }
   }
   
   public func hash(into hasher:inout Hasher) {
-    hasher.combine(self._core)
+    switch self._storage {
+    case .interned(let id):
+      hasher.combine(id)
+    case .core(let core):
+      hasher.combine(core)
+    }
     hasher.combine(self._parameters)
   }
 }
@@ -172,6 +219,14 @@ extension MIMEType {
   ///
   /// - parameter string: must be `type "/" [tree "."] subtype ["+" suffix] *[";" parameter]`
   public init?<S>(_ string: S) where S: StringProtocol {
+    // Fast path for interned MIME types.
+    let (essence_s, fast_parameters_s) = string.splitOnce(separator:";")
+    if let id = _internedMIMETypeID(of:essence_s.utf8) {
+      let parameters:[String:String]? = fast_parameters_s != nil ? Dictionary<String,String>(parsing:String(fast_parameters_s!)) : nil
+      self.init(internedID:id, parameters:parameters)
+      return
+    }
+    
     let (type_s, tree_subtype_suffix_parameters_s_nilable) = string.splitOnce(separator:"/")
     
     guard let type = TopLevelType(rawValue:type_s.lowercased()) else { return nil }
@@ -215,22 +270,33 @@ extension MIMEType {
 extension MIMEType {
   /// Returns a set of possible path extensions for the MIME Type represented by the instance.
   public var possiblePathExtensions:Set<MIMEType.PathExtension>? {
-    return _mimeType_to_ext[self._core]
+    guard case .interned(let id) = self._storage else { return nil }
+    return _internedMIMETypePathExtensions[Int(id)]
   }
   
   /// Initialize with a path extension.
   public init?(pathExtension:MIMEType.PathExtension, parameters:[String:String]? = nil) {
-    guard let core = _ext_to_mimeType[pathExtension] else { return nil }
-    self.init(core:core, parameters:parameters)
+    self.init(internedID:pathExtension._internedMIMETypeID, parameters:parameters)
+  }
+  
+  /// Initialize with a path extension such as "html" or "HTML".
+  public init?<S>(pathExtension:S, parameters:[String:String]? = nil) where S: StringProtocol {
+    guard let pathExtension = MIMEType.PathExtension(caseInsensitiveString:pathExtension) else { return nil }
+    self.init(pathExtension:pathExtension, parameters:parameters)
   }
 }
 
 extension MIMEType: CustomStringConvertible {
   public var description: String {
-    var desc : String = "\(self.type.rawValue)/"
-    if let tree = self.tree { desc += "\(tree.rawValue)." }
-    desc += self.subtype
-    if let suffix = self.suffix { desc += "+\(suffix.rawValue)" }
+    var desc : String
+    if case .interned(let id) = self._storage {
+      desc = _internedMIMETypeStrings[Int(id)]
+    } else {
+      desc = "\(self.type.rawValue)/"
+      if let tree = self.tree { desc += "\(tree.rawValue)." }
+      desc += self.subtype
+      if let suffix = self.suffix { desc += "+\(suffix.rawValue)" }
+    }
     
     if let parameters = self.parameters {
       for (key, value) in parameters {
@@ -248,5 +314,6 @@ extension MIMEType: CustomStringConvertible {
 }
 
 extension MIMEType {
+  public static let octetStream: MIMEType = .init(type: .application, subtype: "octet-stream")!
   public static let wwwFormURLEncoded: MIMEType = .init(type: .application, subtype: "x-www-form-urlencoded")!
 }
@@ -0,0 +1,288 @@
+/* *************************************************************************************************
+ MultipartFormData.swift
+   © 2025 YOCKOW.
+     Licensed under MIT License.
+     See "LICENSE.txt" for more information.
+ ************************************************************************************************ */
+
+import CURLClient
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+import Foundation
+
+/// Represents "multipart/form-data" body.
+///
+/// The body is never assembled in memory:
+/// `makeRequestBodySender()` returns a sender that writes each part lazily.
+public struct MultipartFormData: Sendable {
+  public enum Error: Swift.Error, Equatable {
+    case invalidBoundary
+    case failedToGetFileSize
+  }
+
+  /// Represents a part of "multipart/form-data".
+  public struct Part: Sendable {
+    public enum Content: Sendable {
+      case data(Data)
+
+      /// Content of the file which will be read when it is sent.
+      case file(URL, size: UInt64)
+
+      public var size: UInt64 {
+        switch self {
+        case .data(let data):
+          return UInt64(data.count)
+        case .file(_, let size):
+          return size
+        }
+      }
+    }
+
+    public let header: HTTPHeader
+
+    public let content: Content
+
+    public init(header: HTTPHeader, content: Content) {
+      self.header = header
+      self.content = content
+    }
+
+    private static func _header(name: String, filename: String?, contentType: MIMEType?) -> HTTPHeader {
+      var parameters: [ContentDispositionParameterKey: String] = ["name": name]
+      if let filename {
+        parameters["filename"] = filename
+      }
+      var header: HTTPHeader = [.contentDisposition(ContentDisposition(value: .formData, parameters: parameters))]
+      if let contentType {
+        header.insert(.contentType(contentType))
+      }
+      return header
+    }
+
+    /// Creates a part that represents a simple form field.
+    public init(name: String, value: String) {
+      self.init(header: Part._header(name: name, filename: nil, contentType: nil), content: .data(Data(value.utf8)))
+    }
+
+    public init(name: String, filename: String? = nil, contentType: MIMEType? = nil, data: Data) {
+      self.init(
+        header: Part._header(name: name, filename: filename, contentType: contentType),
+        content: .data(data)
+      )
+    }
+
+    /// Creates a part whose content is the file at `fileURL`.
+    /// Only its size is read here.
+    ///
+    /// - parameters:
+    ///   - filename: The last path component of `fileURL` is used if `nil`.
+    ///   - contentType: Inferred from the path extension of `fileURL` if `nil`.
+    public init(name: String, filename: String? = nil, contentType: MIMEType? = nil, fileURL: URL) throws {
+      guard let size = try fileURL.resourceValues(forKeys: [.fileSizeKey]).fileSize else {
+        throw Error.failedToGetFileSize
+      }
+      self.init(
+        header: Part._header(
+          name: name,
+          filename: filename ?? fileURL.lastPathComponent,
+          contentType: contentType ?? MIMEType(pathExtension: fileURL.pathExtension) ?? .octetStream
+        ),
+        content: .file(fileURL, size: UInt64(size))
+      )
+    }
+  }
+
+  public let boundary: String
+
+  public var parts: [Part]
+
+  /// Returns a random string that can be used as a boundary.
+  public static func randomBoundary() -> String {
+    return "SwiftNetworkGearBoundary\(UUID().uuidString.replacingOccurrences(of: "-", with: ""))"
+  }
+
+  public init(boundary: String = MultipartFormData.randomBoundary(), parts: [Part] = []) throws {
+    // https://www.rfc-editor.org/rfc/rfc2046#section-5.1.1
+    guard (1...70).contains(boundary.utf8.count),
+          boundary.utf8.last != 0x20,
+          boundary.unicodeScalars.allSatisfy(\._isMultipartBoundaryCharacter) else {
+      throw Error.invalidBoundary
+    }
+    self.boundary = boundary
+    self.parts = parts
+  }
+
+  /// "multipart/form-data; boundary=..."
+  public var contentType: MIMEType {
+    return MIMEType(type: .multipart, subtype: "form-data", parameters: ["boundary": boundary])!
+  }
+
+  /// The number of bytes of the entire body.
+  /// It is told to libcurl by `SimpleHTTPConnection.Request.Body(multipartFormData:)`
+  /// so that chunked transfer encoding is not required.
+  public var contentLength: UInt64 {
+    return RequestBodySender._makeSegments(of: self).reduce(0) { $0 + $1.size }
+  }
+
+  /// "Content-Type" to be sent with the body.
+  ///
+  /// "Content-Length" is not contained because libcurl sends it.
+  public var headerFields: [HTTPHeaderField] {
+    return [.contentType(contentType)]
+  }
+
+  /// A `CURLRequestBodySender` that writes parts lazily.
+  /// File contents are read directly into libcurl's buffer.
+  public struct RequestBodySender: CURLRewindableRequestBodySender {
+    fileprivate enum _Segment {
+      case bytes(Data)
+      case file(URL, size: UInt64)
+
+      var size: UInt64 {
+        switch self {
+        case .bytes(let data):
+          return UInt64(data.count)
+        case .file(_, let size):
+          return size
+        }
+      }
+    }
+
+    private final class _OpenedFile {
+      let fileDescriptor: CInt
+
+      init?(_ url: URL, offset: UInt64) {
+        let fileDescriptor = url.withUnsafeFileSystemRepresentation { (path) -> CInt in
+          guard let path else { return -1 }
+          return open(path, O_RDONLY)
+        }
+        guard fileDescriptor >= 0 else { return nil }
+        guard lseek(fileDescriptor, off_t(offset), SEEK_SET) >= 0 else {
+          close(fileDescriptor)
+          return nil
+        }
+        self.fileDescriptor = fileDescriptor
+      }
+
+      deinit {
+        close(fileDescriptor)
+      }
+    }
+
+    fileprivate static func _makeSegments(of multipartFormData: MultipartFormData) -> [_Segment] {
+      let boundary = multipartFormData.boundary
+      var segments: [_Segment] = []
+      for part in multipartFormData.parts {
+        // `HTTPHeader.description` ends with an empty line.
+        segments.append(.bytes(Data("--\(boundary)\r\n\(part.header.description)".utf8)))
+        switch part.content {
+        case .data(let data):
+          segments.append(.bytes(data))
+        case .file(let url, let size):
+          segments.append(.file(url, size: size))
+        }
+        segments.append(.bytes(Data("\r\n".utf8)))
+      }
+      segments.append(.bytes(Data("--\(boundary)--\r\n".utf8)))
+      return segments
+    }
+
+    private let _segments: [_Segment]
+
+    private var _currentSegmentIndex: Int = 0
+
+    private var _currentOffsetInSegment: UInt64 = 0
+
+    private var _currentFile: _OpenedFile? = nil
+
+    fileprivate init(_ multipartFormData: MultipartFormData) {
+      self._segments = RequestBodySender._makeSegments(of: multipartFormData)
+    }
+
+    public mutating func readNextPartialRequestBody(_ buffer: UnsafeMutablePointer<CChar>, maxLength: CSize) -> CSize {
+      var count: Int = 0
+      while count < maxLength && _currentSegmentIndex < _segments.count {
+        let segment = _segments[_currentSegmentIndex]
+        if _currentOffsetInSegment == segment.size {
+          _currentSegmentIndex += 1
+          _currentOffsetInSegment = 0
+          _currentFile = nil
+          continue
+        }
+        let available = Int(min(UInt64(maxLength - count), segment.size - _currentOffsetInSegment))
+        switch segment {
+        case .bytes(let data):
+          let start = data.startIndex + Int(_currentOffsetInSegment)
+          data.copyBytes(
+            to: UnsafeMutableRawPointer(buffer + count).assumingMemoryBound(to: UInt8.self),
+            from: start..<(start + available)
+          )
+          count += available
+          _currentOffsetInSegment += UInt64(available)
+        case .file(let url, _):
+          if _currentFile == nil {
+            _currentFile = _OpenedFile(url, offset: _currentOffsetInSegment)
+          }
+          guard let file = _currentFile else { return -1 }
+          let readCount = read(file.fileDescriptor, buffer + count, available)
+          guard readCount > 0 else {
+            // The file may be shrunk after the size was determined.
+            return -1
+          }
+          count += readCount
+          _currentOffsetInSegment += UInt64(readCount)
+        }
+      }
+      return count
+    }
+
+    public mutating func rewindRequestBody(toOffset offset: UInt64) -> Bool {
+      var remaining = offset
+      for (ii, segment) in _segments.enumerated() {
+        if remaining < segment.size {
+          _currentSegmentIndex = ii
+          _currentOffsetInSegment = remaining
+          _currentFile = nil
+          return true
+        }
+        remaining -= segment.size
+      }
+      guard remaining == 0 else { return false }
+      _currentSegmentIndex = _segments.count
+      _currentOffsetInSegment = 0
+      _currentFile = nil
+      return true
+    }
+  }
+
+  public func makeRequestBodySender() -> RequestBodySender {
+    return RequestBodySender(self)
+  }
+}
+
+extension SimpleHTTPConnection.Request.Body {
+  /// Initializes a request body with given `multipartFormData`.
+  /// Its size is computed in advance so that "Content-Length" is sent by libcurl.
+  ///
+  /// - Note: `multipartFormData.headerFields` should be sent as the request header.
+  public init(multipartFormData: MultipartFormData) {
+    self.init(multipartFormData.makeRequestBodySender(), size: multipartFormData.contentLength)
+  }
+}
+
+extension Unicode.Scalar {
+  /// bcharsnospace := DIGIT / ALPHA / "'" / "(" / ")" / "+" / "_" / "," / "-" / "." / "/" / ":" / "=" / "?"
+  /// bchars := bcharsnospace / " "
+  fileprivate var _isMultipartBoundaryCharacter: Bool {
+    switch self {
+    case "0"..."9", "A"..."Z", "a"..."z",
+         "'", "(", ")", "+", "_", ",", "-", ".", "/", ":", "=", "?", " ":
+      return true
+    default:
+      return false
+    }
+  }
+}
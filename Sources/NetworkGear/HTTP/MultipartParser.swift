@@ -0,0 +1,264 @@
+/* *************************************************************************************************
+ MultipartParser.swift
+   © 2025 YOCKOW.
+     Licensed under MIT License.
+     See "LICENSE.txt" for more information.
+ ************************************************************************************************ */
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+import Foundation
+import yExtensions
+
+public enum MultipartParseError: Error, Equatable {
+  case invalidBoundary
+  case invalidDelimiterLine
+  case invalidHeader
+  case tooLargeHeader
+  case unexpectedEndOfBody
+}
+
+/// An incremental parser for "multipart/\*" body.
+///
+/// Bytes can be given in arbitrary chunks by `write(contentsOf:)`.
+/// Given chunks are scanned in place; only a few bytes that may be a part of the delimiter
+/// (and header of the current part) are retained, so that memory usage doesn't depend on the size
+/// of each part.
+public final class MultipartParser {
+  public enum Event {
+    /// The header of the next part.
+    case partHeader(HTTPHeader)
+
+    /// A part of the content of the current part.
+    /// The buffer is valid only during the handler call.
+    case partContent(UnsafeRawBufferPointer)
+
+    /// The end of the current part.
+    case partEnd
+  }
+
+  private enum _State {
+    case preamble
+    case delimiterLine
+    case header
+    case content
+    case epilogue
+  }
+
+  /// Maximum number of bytes of each part's header.
+  public static let maxHeaderLength: Int = 16 * 1024
+
+  /// "CRLF--boundary"
+  private let _delimiter: [UInt8]
+
+  private let _handler: (Event) throws -> Void
+
+  private var _state: _State = .preamble
+
+  /// Bytes that have not been consumed yet.
+  private var _buffer: [UInt8]
+
+  /// The number of bytes of the current part's header where its end has already been searched.
+  private var _headerSearchedLength: Int = 0
+
+  public init(boundary: String, handler: @escaping (Event) throws -> Void) throws {
+    guard (1...70).contains(boundary.utf8.count) else {
+      throw MultipartParseError.invalidBoundary
+    }
+    self._delimiter = Array("\r\n--\(boundary)".utf8)
+    self._handler = handler
+    // Pretend that the body is preceded by CRLF so that the first delimiter can be found in the
+    // same way as others.
+    self._buffer = [0x0D, 0x0A]
+  }
+
+  /// Initializes a parser with the boundary specified by `contentType`.
+  public convenience init(contentType: MIMEType, handler: @escaping (Event) throws -> Void) throws {
+    guard contentType.type == .multipart, let boundary = contentType.parameters?["boundary"] else {
+      throw MultipartParseError.invalidBoundary
+    }
+    try self.init(boundary: boundary, handler: handler)
+  }
+
+  /// Returns `true` if the closing delimiter has been found.
+  public var isFinished: Bool {
+    guard case .epilogue = _state else { return false }
+    return true
+  }
+
+  /// Parses the given chunk.
+  public func write<D>(contentsOf data: D) throws where D: DataProtocol {
+    for region in data.regions {
+      try region.withUnsafeBytes { try _parse($0) }
+    }
+  }
+
+  /// Call this method when the whole body is given.
+  public func finish() throws {
+    guard isFinished else {
+      throw MultipartParseError.unexpectedEndOfBody
+    }
+  }
+
+  private func _parse(_ bytes: UnsafeRawBufferPointer) throws {
+    var bytes = bytes
+    // Resolve the retained bytes first, borrowing as few bytes as possible from the chunk.
+    while !_buffer.isEmpty && !bytes.isEmpty {
+      if case .epilogue = _state {
+        return
+      }
+      let retainedCount = _buffer.count
+      let borrowedCount = min(bytes.count, _delimiter.count)
+      _buffer.append(contentsOf: UnsafeRawBufferPointer(rebasing: bytes[..<borrowedCount]))
+      let consumedCount = try _buffer.withUnsafeBytes { try _consume($0) }
+      if consumedCount >= retainedCount {
+        // The rest of the chunk can be scanned directly.
+        _buffer.removeAll(keepingCapacity: true)
+        bytes = UnsafeRawBufferPointer(rebasing: bytes[(consumedCount - retainedCount)...])
+      } else {
+        _buffer.removeFirst(consumedCount)
+        bytes = UnsafeRawBufferPointer(rebasing: bytes[borrowedCount...])
+      }
+    }
+    if case .epilogue = _state {
+      return
+    }
+    if bytes.isEmpty {
+      return
+    }
+    let consumedCount = try _consume(bytes)
+    _buffer.append(contentsOf: UnsafeRawBufferPointer(rebasing: bytes[consumedCount...]))
+  }
+
+  /// Parses `buffer` as much as possible and returns the number of consumed bytes.
+  private func _consume(_ buffer: UnsafeRawBufferPointer) throws -> Int {
+    var position = 0
+    parsing: while true {
+      switch _state {
+      case .preamble, .content:
+        let (delimiterPosition, safeEnd) = _searchDelimiter(in: buffer, from: position)
+        if case .content = _state, safeEnd > position {
+          try _handler(.partContent(UnsafeRawBufferPointer(rebasing: buffer[position..<safeEnd])))
+        }
+        guard let delimiterPosition else {
+          position = safeEnd
+          break parsing
+        }
+        if case .content = _state {
+          try _handler(.partEnd)
+        }
+        position = delimiterPosition + _delimiter.count
+        _state = .delimiterLine
+      case .delimiterLine:
+        // "--" (close-delimiter) or transport-padding CRLF
+        let remaining = buffer.count - position
+        if remaining >= 2 && buffer[position] == 0x2D && buffer[position + 1] == 0x2D {
+          _state = .epilogue
+          position = buffer.count
+          break parsing
+        }
+        var ii = position
+        while ii < buffer.count && (buffer[ii] == 0x20 || buffer[ii] == 0x09) {
+          ii += 1
+        }
+        guard ii + 1 < buffer.count else {
+          break parsing
+        }
+        guard buffer[ii] == 0x0D && buffer[ii + 1] == 0x0A else {
+          throw MultipartParseError.invalidDelimiterLine
+        }
+        position = ii + 2
+        _state = .header
+        _headerSearchedLength = 0
+      case .header:
+        guard let headerEnd = _searchHeaderEnd(in: buffer, from: position) else {
+          if buffer.count - position > MultipartParser.maxHeaderLength {
+            throw MultipartParseError.tooLargeHeader
+          }
+          break parsing
+        }
+        try _handler(.partHeader(try _parseHeader(UnsafeRawBufferPointer(rebasing: buffer[position..<headerEnd]))))
+        // Skip the empty line.
+        position = headerEnd + 2
+        _state = .content
+      case .epilogue:
+        position = buffer.count
+        break parsing
+      }
+    }
+    return position
+  }
+
+  /// Searches the delimiter.
+  ///
+  /// - Returns: A tuple of the position of the delimiter (if found) and the position until which
+  ///            the bytes are surely not a part of the delimiter.
+  private func _searchDelimiter(in buffer: UnsafeRawBufferPointer, from start: Int) -> (Int?, Int) {
+    guard let base = buffer.baseAddress else { return (nil, start) }
+    let count = buffer.count
+    let delimiterCount = _delimiter.count
+    var position = start
+    return _delimiter.withUnsafeBytes { (delimiter) -> (Int?, Int) in
+      while position < count {
+        // `memchr` is vectorized by the C library.
+        guard let found = memchr(base + position, 0x0D, count - position) else {
+          return (nil, count)
+        }
+        let candidate = base.distance(to: UnsafeRawPointer(found))
+        let available = min(delimiterCount, count - candidate)
+        if memcmp(base + candidate, delimiter.baseAddress!, available) == 0 {
+          if available == delimiterCount {
+            return (candidate, candidate)
+          }
+          // Partial match at the end of the buffer.
+          return (nil, candidate)
+        }
+        position = candidate + 1
+      }
+      return (nil, count)
+    }
+  }
+
+  /// Returns the position of CRLF that is followed by the empty line.
+  ///
+  /// `start` must be the start of the header.
+  /// The search resumes from where the previous call gave up.
+  private func _searchHeaderEnd(in buffer: UnsafeRawBufferPointer, from start: Int) -> Int? {
+    // The header may be empty.
+    if buffer.count - start >= 2 && buffer[start] == 0x0D && buffer[start + 1] == 0x0A {
+      return start
+    }
+    var ii = start + _headerSearchedLength
+    while ii + 3 < buffer.count {
+      if buffer[ii] == 0x0D && buffer[ii + 1] == 0x0A && buffer[ii + 2] == 0x0D && buffer[ii + 3] == 0x0A {
+        return ii + 2
+      }
+      ii += 1
+    }
+    _headerSearchedLength = max(0, ii - start)
+    return nil
+  }
+
+  /// Parses header lines.
+  /// `bytes` must not contain the empty line.
+  private func _parseHeader(_ bytes: UnsafeRawBufferPointer) throws -> HTTPHeader {
+    guard let string = String(bytes: bytes, encoding: .utf8) else {
+      throw MultipartParseError.invalidHeader
+    }
+    var header: HTTPHeader = []
+    for line in string.split(separator: "\r\n", omittingEmptySubsequences: true) {
+      guard case let (name, value?) = line.splitOnce(separator: ":"),
+            let fieldName = HTTPHeaderFieldName(rawValue: name.trimmingCharacters(in: .whitespaces)),
+            let fieldValue = HTTPHeaderFieldValue(rawValue: value.trimmingCharacters(in: .whitespaces)) else {
+        throw MultipartParseError.invalidHeader
+      }
+      header.insert(HTTPHeaderField(name: fieldName, value: fieldValue))
+    }
+    return header
+  }
+}
+
+extension MultipartParser: SimpleHTTPConnectionResponseBodyReceiver {}
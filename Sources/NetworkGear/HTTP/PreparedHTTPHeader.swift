@@ -0,0 +1,25 @@
+/* *************************************************************************************************
+ PreparedHTTPHeader.swift
+   © 2025 YOCKOW.
+     Licensed under MIT License.
+     See "LICENSE.txt" for more information.
+ ************************************************************************************************ */
+
+import CURLClient
+
+/// Represents an immutable HTTP header that is serialized only once.
+///
+/// It is useful when the same header fields are sent with many requests.
+/// An instance can be shared among concurrent requests.
+public struct PreparedHTTPHeader: Sendable {
+  /// The header that this instance represents.
+  public let header: HTTPHeader
+
+  internal let _list: CURLPreparedHeaderFieldList
+
+  /// Serializes `header`.
+  public init(_ header: HTTPHeader) throws {
+    self.header = header
+    self._list = try CURLPreparedHeaderFieldList(header.map({ (name: $0.name.rawValue, value: $0.value.rawValue) }))
+  }
+}
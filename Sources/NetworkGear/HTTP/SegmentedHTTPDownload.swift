@@ -0,0 +1,488 @@
+/* *************************************************************************************************
+ SegmentedHTTPDownload.swift
+   © 2025 YOCKOW.
+     Licensed under MIT License.
+     See "LICENSE.txt" for more information.
+ ************************************************************************************************ */
+
+import CLibCURL
+import CURLClient
+import Dispatch
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+import Foundation
+import yExtensions
+
+/// Downloads a resource into a file using concurrent range requests.
+///
+/// 1. Probes the size, range support and the validator of the resource with `HEAD`.
+/// 2. Splits the transfer into some `Range` requests that run concurrently.
+/// 3. Every request is validated with `If-Range` so that a modified resource is never mixed.
+/// 4. Each segment is written to the destination at its offset with `pwrite`.
+///
+/// Progress is recorded in a small sidecar file (see `progressFileURL`),
+/// so that the download can be resumed after a crash by performing the same download again.
+/// If the resource doesn't support range requests, it is downloaded with a single `GET`.
+public struct SegmentedHTTPDownload: Sendable {
+  public enum Error: Swift.Error, Equatable {
+    case unexpectedStatusCode(CURLResponseCode)
+    case unexpectedContentRange
+    /// The resource was modified during the download.
+    case validatorChanged
+    case incompleteSegment
+    case failedToOpenFile(errno: CInt)
+    case failedToWriteFile(errno: CInt)
+  }
+
+  /// The URL of the resource.
+  public let url: URL
+
+  /// The URL of the file to which the resource will be written.
+  public let destination: URL
+
+  /// The maximum number of concurrent requests.
+  public let maxNumberOfSegments: Int
+
+  /// Segments are never smaller than this size unless the resource itself is smaller.
+  public let minimumSegmentSize: UInt64
+
+  /// Additional header fields sent with every request.
+  public let requestHeader: PreparedHTTPHeader?
+
+  /// The URL of the sidecar file that records the progress.
+  public var progressFileURL: URL {
+    return destination.appendingPathExtension("nwgprogress")
+  }
+
+  public init(
+    url: URL,
+    destination: URL,
+    maxNumberOfSegments: Int = 4,
+    minimumSegmentSize: UInt64 = 1024 * 1024,
+    requestHeader: PreparedHTTPHeader? = nil
+  ) {
+    self.url = url
+    self.destination = destination
+    self.maxNumberOfSegments = max(1, maxNumberOfSegments)
+    self.minimumSegmentSize = max(1, minimumSegmentSize)
+    self.requestHeader = requestHeader
+  }
+
+  // MARK: - Probe
+
+  internal struct _Probe {
+    var contentLength: UInt64?
+    var acceptsRanges: Bool
+    /// The value of "If-Range".
+    var validator: String?
+  }
+
+  private func _probe() async throws -> _Probe {
+    let connection = SimpleHTTPConnection(
+      url: url,
+      method: .head,
+      preparedRequestHeader: requestHeader,
+      redirectStrategy: .followRedirects
+    )
+    let response = try await connection.response()
+    guard response.statusCode == .ok else {
+      throw Error.unexpectedStatusCode(CURLResponseCode(response.statusCode.rawValue))
+    }
+    let header = response.header
+    let contentLength = header[.contentLength].first.flatMap({ UInt64($0.value.rawValue) })
+    let acceptsRanges = header[.acceptRanges].contains(where: {
+      $0.value.rawValue.lowercased().split(separator: ",").contains(where: {
+        $0.trimmingCharacters(in: .whitespaces) == "bytes"
+      })
+    })
+
+    let validator = SegmentedHTTPDownload._validator(in: response._rawHeaderFields)
+
+    return _Probe(contentLength: contentLength, acceptsRanges: acceptsRanges, validator: validator)
+  }
+
+  /// Returns the value of "If-Range" chosen from `fields` according to RFC 9110 §13.1.5,
+  /// or `nil` if the resource must be downloaded with a single `GET`.
+  ///
+  /// - A strong entity tag is used as it is.
+  /// - A date must not be used if there is an entity tag even when it is weak.
+  /// - "Last-Modified" is used only if it is a strong validator,
+  ///   i.e. "Date" is at least one second later than it.
+  ///
+  /// The value is sent exactly as it was received.
+  internal static func _validator(in fields: Array<CURLHeaderField>) -> String? {
+    func __value(of name: HTTPHeaderFieldName) -> String? {
+      return fields.first(where: { HTTPHeaderFieldName(rawValue: $0.name) == name })?.value
+    }
+    func __date(of name: HTTPHeaderFieldName) -> Date? {
+      return __value(of: name).flatMap({ HTTPHeaderFieldValue(rawValue: $0) }).flatMap({ Date($0) })
+    }
+
+    if let eTag = __value(of: .eTag) {
+      guard case .strong = HTTPETag(eTag) else { return nil }
+      return eTag
+    }
+    guard let lastModified = __value(of: .lastModified),
+          let lastModifiedDate = __date(of: .lastModified),
+          let date = __date(of: .date),
+          date.timeIntervalSince(lastModifiedDate) >= 1 else {
+      return nil
+    }
+    return lastModified
+  }
+
+  // MARK: - Progress
+
+  internal struct _ProgressFile: Codable, Equatable {
+    struct Segment: Codable, Equatable {
+      /// The first byte position of the segment.
+      let start: UInt64
+
+      /// The last byte position of the segment (inclusive).
+      let end: UInt64
+
+      /// The number of bytes that have been written.
+      var completed: UInt64
+
+      var isCompleted: Bool {
+        return start + completed > end
+      }
+    }
+
+    let url: String
+    let contentLength: UInt64
+    let validator: String
+    var segments: [Segment]
+  }
+
+  /// Records progress of segments concurrently.
+  private final class _ProgressRecorder: @unchecked Sendable {
+    /// The progress file is rewritten when this amount of bytes are written since the last time.
+    private static let _flushInterval: UInt64 = 8 * 1024 * 1024
+
+    private var _progress: _ProgressFile
+    private let _fileURL: URL
+    private let _file: _File
+    private var _unflushedCount: UInt64 = 0
+    private let _queue: DispatchQueue = .init(
+      label: "jp.YOCKOW.NetworkGear.SegmentedHTTPDownload.\(UUID().uuidString)"
+    )
+
+    init(_ progress: _ProgressFile, fileURL: URL, file: _File) {
+      self._progress = progress
+      self._fileURL = fileURL
+      self._file = file
+    }
+
+    private func _flush() throws {
+      // The progress must not claim bytes that have not reached the disk.
+      guard fsync(_file.fileDescriptor) == 0 else {
+        throw Error.failedToWriteFile(errno: errno)
+      }
+      try JSONEncoder().encode(_progress).write(to: _fileURL, options: .atomic)
+      _unflushedCount = 0
+    }
+
+    func flush() throws {
+      try _queue.sync { try _flush() }
+    }
+
+    /// Must be called after the bytes are actually written.
+    func segment(at index: Int, didWrite count: UInt64) {
+      _queue.sync {
+        _progress.segments[index].completed += count
+        _unflushedCount += count
+        if _unflushedCount >= _ProgressRecorder._flushInterval || _progress.segments[index].isCompleted {
+          // Failure of recording progress must not interrupt the download.
+          try? _flush()
+        }
+      }
+    }
+  }
+
+  internal func _loadProgress(probe: _Probe) -> _ProgressFile? {
+    guard FileManager.default.fileExists(atPath: destination.path),
+          let data = try? Data(contentsOf: progressFileURL),
+          let progress = try? JSONDecoder().decode(_ProgressFile.self, from: data),
+          progress.url == url.absoluteString,
+          progress.contentLength == probe.contentLength,
+          progress.validator == probe.validator else {
+      return nil
+    }
+    return progress
+  }
+
+  internal func _newProgress(contentLength: UInt64, validator: String) -> _ProgressFile {
+    guard contentLength > 0 else {
+      return _ProgressFile(url: url.absoluteString, contentLength: 0, validator: validator, segments: [])
+    }
+    let numberOfSegments = max(1, min(
+      UInt64(maxNumberOfSegments),
+      (contentLength + minimumSegmentSize - 1) / minimumSegmentSize
+    ))
+    let segmentSize = (contentLength + numberOfSegments - 1) / numberOfSegments
+    let segments = stride(from: UInt64(0), to: contentLength, by: Int(segmentSize)).map {
+      _ProgressFile.Segment(start: $0, end: min($0 + segmentSize, contentLength) - 1, completed: 0)
+    }
+    return _ProgressFile(
+      url: url.absoluteString,
+      contentLength: contentLength,
+      validator: validator,
+      segments: segments
+    )
+  }
+
+  // MARK: - Transfer
+
+  internal final class _File: @unchecked Sendable {
+    let fileDescriptor: CInt
+
+    init(_ url: URL, truncatingTo length: UInt64?) throws {
+      let fileDescriptor = url.withUnsafeFileSystemRepresentation { (path) -> CInt in
+        guard let path else { return -1 }
+        return open(path, O_WRONLY | O_CREAT, 0o644)
+      }
+      guard fileDescriptor >= 0 else {
+        throw Error.failedToOpenFile(errno: errno)
+      }
+      if let length, ftruncate(fileDescriptor, off_t(length)) != 0 {
+        let error = errno
+        close(fileDescriptor)
+        throw Error.failedToOpenFile(errno: error)
+      }
+      self.fileDescriptor = fileDescriptor
+    }
+
+    deinit {
+      close(fileDescriptor)
+    }
+  }
+
+  /// Shared among segments so that one failure stops the others.
+  internal final class _AbortFlag: @unchecked Sendable {
+    private var _error: (any Swift.Error)? = nil
+    private let _queue: DispatchQueue = .init(
+      label: "jp.YOCKOW.NetworkGear.SegmentedHTTPDownload.AbortFlag.\(UUID().uuidString)"
+    )
+
+    /// The first error passed to `abort(with:)`.
+    var error: (any Swift.Error)? {
+      return _queue.sync { _error }
+    }
+
+    var isAborted: Bool {
+      return error != nil
+    }
+
+    func abort(with error: any Swift.Error) {
+      _queue.sync {
+        if _error == nil {
+          _error = error
+        }
+      }
+    }
+  }
+
+  /// Writes the response body at the offset with `pwrite` only if the response is expected one.
+  internal final class _SegmentDelegate: CURLClientGeneralDelegate, @unchecked Sendable {
+    private let _file: _File
+
+    /// `nil` if the entire resource is requested without "Range".
+    private let _range: ClosedRange<UInt64>?
+
+    private let _abortFlag: _AbortFlag
+
+    private let _didWrite: (UInt64) -> Void
+
+    private var _validated: Bool = false
+
+    private(set) var offset: UInt64
+
+    private(set) var failure: (any Swift.Error)? = nil
+
+    init(
+      file: _File,
+      range: ClosedRange<UInt64>?,
+      abortFlag: _AbortFlag,
+      requestHeaderFields: [CURLHeaderField],
+      preparedRequestHeaderFields: CURLPreparedHeaderFieldList?,
+      didWrite: @escaping (UInt64) -> Void
+    ) {
+      self._file = file
+      self._range = range
+      self._abortFlag = abortFlag
+      self._didWrite = didWrite
+      self.offset = range?.lowerBound ?? 0
+      super.init(
+        requestHeaderFields: requestHeaderFields,
+        preparedRequestHeaderFields: preparedRequestHeaderFields
+      )
+    }
+
+    private func _validate() throws {
+      guard let range = _range else {
+        guard responseCode == 200 else { throw SegmentedHTTPDownload.Error.unexpectedStatusCode(responseCode) }
+        return
+      }
+      switch responseCode {
+      case 206:
+        // "Content-Range: bytes first-last/complete-length"
+        guard let contentRange = responseHeaderFields.last(where: { $0.name.lowercased() == "content-range" }),
+              case let (unit, rangeAndLength?) = contentRange.value.splitOnce(separator: " "),
+              unit.lowercased() == "bytes",
+              let first = rangeAndLength.split(separator: "-", maxSplits: 1).first,
+              UInt64(first) == range.lowerBound else {
+          throw SegmentedHTTPDownload.Error.unexpectedContentRange
+        }
+      case 200:
+        // "If-Range" didn't match.
+        throw SegmentedHTTPDownload.Error.validatorChanged
+      default:
+        throw SegmentedHTTPDownload.Error.unexpectedStatusCode(responseCode)
+      }
+    }
+
+    override func writeNextPartialResponseBody(_ bodyPart: UnsafeMutablePointer<CChar>, length: CSize) -> CSize {
+      do {
+        // `curl_easy_perform` can be interrupted only here.
+        if Task.isCancelled || _abortFlag.isAborted {
+          throw CancellationError()
+        }
+        if !_validated {
+          try _validate()
+          _validated = true
+        }
+        if let range = _range, offset + UInt64(length) > range.upperBound + 1 {
+          throw SegmentedHTTPDownload.Error.unexpectedContentRange
+        }
+        var written = 0
+        while written < length {
+          let result = pwrite(_file.fileDescriptor, bodyPart + written, length - written, off_t(offset))
+          guard result >= 0 else {
+            throw SegmentedHTTPDownload.Error.failedToWriteFile(errno: errno)
+          }
+          written += result
+          offset += UInt64(result)
+        }
+        _didWrite(UInt64(length))
+        return length
+      } catch {
+        failure = error
+        return -1
+      }
+    }
+  }
+
+  /// Performs a request for `range` and writes the response body into `file`.
+  internal typealias _Transfer = @Sendable (
+    _ file: _File,
+    _ range: ClosedRange<UInt64>?,
+    _ validator: String?,
+    _ abortFlag: _AbortFlag,
+    _ didWrite: @escaping @Sendable (UInt64) -> Void
+  ) async throws -> Void
+
+  private func _transfer(
+    file: _File,
+    range: ClosedRange<UInt64>?,
+    validator: String?,
+    abortFlag: _AbortFlag,
+    didWrite: @escaping @Sendable (UInt64) -> Void
+  ) async throws {
+    try Task.checkCancellation()
+    var requestHeaderFields: [CURLHeaderField] = []
+    if let range {
+      requestHeaderFields.append((name: "Range", value: "bytes=\(range.lowerBound)-\(range.upperBound)"))
+    }
+    if let validator {
+      requestHeaderFields.append((name: "If-Range", value: validator))
+    }
+    let delegate = _SegmentDelegate(
+      file: file,
+      range: range,
+      abortFlag: abortFlag,
+      requestHeaderFields: requestHeaderFields,
+      preparedRequestHeaderFields: requestHeader?._list,
+      didWrite: didWrite
+    )
+    let client = try CURLManager.shared.makeEasyClient()
+    try await client.setURL(url)
+    try await client.setHTTPMethodToGet()
+    try await client.setMaxNumberOfRedirectsAllowed(30)
+    do {
+      try await client.perform(delegate: delegate)
+    } catch {
+      throw delegate.failure ?? error
+    }
+    if let range, delegate.offset != range.upperBound + 1 {
+      throw Error.incompleteSegment
+    }
+  }
+
+  /// Downloads the resource.
+  /// If the progress file exists and it is valid, the download is resumed.
+  ///
+  /// When one of segments fails or the task is cancelled, the other segments are aborted.
+  public func perform() async throws {
+    let probe = try await _probe()
+    try await _perform(probe: probe, transfer: {
+      try await self._transfer(file: $0, range: $1, validator: $2, abortFlag: $3, didWrite: $4)
+    })
+  }
+
+  internal func _perform(probe: _Probe, transfer: @escaping _Transfer) async throws {
+    let abortFlag = _AbortFlag()
+    guard let contentLength = probe.contentLength,
+          probe.acceptsRanges,
+          let validator = probe.validator else {
+      // Fallback
+      try? FileManager.default.removeItem(at: progressFileURL)
+      let file = try _File(destination, truncatingTo: 0)
+      try await transfer(file, nil, nil, abortFlag, { _ in })
+      return
+    }
+
+    let resumedProgress = _loadProgress(probe: probe)
+    let progress = resumedProgress ?? _newProgress(contentLength: contentLength, validator: validator)
+    let file = try _File(destination, truncatingTo: resumedProgress == nil ? contentLength : nil)
+    let recorder = _ProgressRecorder(progress, fileURL: progressFileURL, file: file)
+    try recorder.flush()
+
+    do {
+      try await withThrowingTaskGroup(of: Void.self) { group in
+        for (index, segment) in progress.segments.enumerated() where !segment.isCompleted {
+          group.addTask {
+            do {
+              try await transfer(
+                file,
+                (segment.start + segment.completed)...segment.end,
+                validator,
+                abortFlag,
+                { recorder.segment(at: index, didWrite: $0) }
+              )
+            } catch {
+              abortFlag.abort(with: error)
+              throw error
+            }
+          }
+        }
+        try await group.waitForAll()
+      }
+    } catch {
+      // Report the failure that caused the abortion rather than cancellation of other segments.
+      let error = abortFlag.error ?? error
+      if case Error.validatorChanged = error {
+        // The progress is no longer valid.
+        try? FileManager.default.removeItem(at: progressFileURL)
+      } else {
+        try? recorder.flush()
+      }
+      throw error
+    }
+
+    try FileManager.default.removeItem(at: progressFileURL)
+  }
+}
@@ -21,12 +21,36 @@ public actor SimpleHTTPConnection {
     public struct Body: Sendable {
       fileprivate let _body: CURLClientGeneralDelegate.RequestBody
 
+      /// The number of bytes of the body if it is known in advance.
+      public let size: UInt64?
+
       public init(_ body: CURLClientGeneralDelegate.RequestBody) {
         self._body = body
+        self.size = nil
       }
 
       public init<T>(_ sender: T) where T: CURLRequestBodySender {
         self._body = .init(sender)
+        self.size = nil
+      }
+
+      public init<T>(_ sender: T) where T: CURLRewindableRequestBodySender {
+        self._body = .init(sender)
+        self.size = nil
+      }
+
+      /// Initializes a request body whose size is known in advance.
+      ///
+      /// libcurl is told `size` so that "Content-Length" is sent instead of chunked transfer encoding.
+      /// "Content-Length" must not be specified in the request header.
+      public init<T>(_ sender: T, size: UInt64) where T: CURLRequestBodySender {
+        self._body = .init(sender)
+        self.size = size
+      }
+
+      public init<T>(_ sender: T, size: UInt64) where T: CURLRewindableRequestBodySender {
+        self._body = .init(sender)
+        self.size = size
       }
 
       /// Initializes a request body with given `stream`.
@@ -34,14 +58,17 @@ public actor SimpleHTTPConnection {
       /// - Note: The given `stream` must not be read from other than the connection intended.
       public init(stream: InputStream) {
         self._body = .init(stream: stream)
+        self.size = nil
       }
 
       public init(data: Data) {
         self._body = .init(data: data)
+        self.size = nil
       }
 
       public init<D>(data: D) where  D: DataProtocol {
         self._body = .init(data: data)
+        self.size = nil
       }
 
       public init<A>(_ sequence: A) where A: AsyncSequence,
@@ -49,10 +76,12 @@ public actor SimpleHTTPConnection {
                                           A.AsyncIterator: Sendable,
                                           A.Element == UInt8 {
         self._body = .init(sequence)
+        self.size = nil
       }
 
       public init<S>(_ sequence: S) where S: Sequence, S.Element == UInt8 {
         self._body = .init(sequence)
+        self.size = nil
       }
     }
 
@@ -78,24 +107,37 @@ public actor SimpleHTTPConnection {
     /// Some fields (i.g. `User-Agent`) are set automatically to default values.
     public let header: HTTPHeader?
 
+    /// HTTP header fields serialized in advance.
+    ///
+    /// Fields in `header` are sent in addition to them.
+    /// If a field in `header` has the same name with any field in `preparedHeader`, the former wins.
+    public let preparedHeader: PreparedHTTPHeader?
+
     /// Request body.
     public let body: Body?
 
     public let redirectStrategy: RedirectStrategy
 
+    /// HTTP version to be used. libcurl's default is used if `nil`.
+    public let httpVersion: EasyClient.HTTPVersion?
+
     /// Initializes the instance with given parameters.
     public init(
       url: URL,
       method: HTTPMethod = .get,
       header: HTTPHeader? = nil,
+      preparedHeader: PreparedHTTPHeader? = nil,
       body: Body? = nil,
-      redirectStrategy: RedirectStrategy = .noFollow
+      redirectStrategy: RedirectStrategy = .noFollow,
+      httpVersion: EasyClient.HTTPVersion? = nil
     ) {
       self.url = url
       self.method = method
       self.header = header
+      self.preparedHeader = preparedHeader
       self.body = body
       self.redirectStrategy = redirectStrategy
+      self.httpVersion = httpVersion
     }
   }
 
@@ -111,15 +153,19 @@ public actor SimpleHTTPConnection {
     url: URL,
     method: HTTPMethod = .get,
     requestHeader: HTTPHeader? = nil,
+    preparedRequestHeader: PreparedHTTPHeader? = nil,
     requestBody: Request.Body? = nil,
-    redirectStrategy: Request.RedirectStrategy = .noFollow
+    redirectStrategy: Request.RedirectStrategy = .noFollow,
+    httpVersion: EasyClient.HTTPVersion? = nil
   ) {
     self.init(request: .init(
       url: url,
       method: method,
       header: requestHeader,
+      preparedHeader: preparedRequestHeader,
       body: requestBody,
-      redirectStrategy: redirectStrategy
+      redirectStrategy: redirectStrategy,
+      httpVersion: httpVersion
     ))
   }
 
@@ -149,6 +195,11 @@ public actor SimpleHTTPConnection {
     public var content: Body? {
       return _delegate.responseBody(as: Body.self)
     }
+
+    /// The header fields exactly as they were received.
+    internal var _rawHeaderFields: Array<CURLHeaderField> {
+      return _delegate.responseHeaderFields
+    }
   }
 
   private func _makeClientAndDelegate(
@@ -170,6 +221,18 @@ public actor SimpleHTTPConnection {
       try await client.setHTTPMethodToCustom(request.method.rawValue)
     }
 
+    if let bodySize = request.body?.size {
+      if request.method == .post {
+        try await client.setPostFieldSize(CCURLOffset(bodySize))
+      } else {
+        try await client.setUploadFileSize(CCURLOffset(bodySize))
+      }
+    }
+
+    if let httpVersion = request.httpVersion {
+      try await client.setHTTPVersion(httpVersion)
+    }
+
     switch request.redirectStrategy {
     case .noFollow:
       try await client.setMaxNumberOfRedirectsAllowed(0)
@@ -183,6 +246,7 @@ public actor SimpleHTTPConnection {
 
     let delegate = CURLClientGeneralDelegate(
       requestHeaderFields: requestHeaderFields,
+      preparedRequestHeaderFields: request.preparedHeader?._list,
       requestBody: request.body?._body,
       responseBody: responseBody
     )
@@ -198,6 +198,90 @@ import Testing
     #expect(response?.headerValue(for: "X-BAR") == "BAR")
   }
 
+  @Test func test_preparedRequestHeaders() async throws {
+    let prepared = try CURLPreparedHeaderFieldList([
+      (name: "X-FOO", value: "FOO"),
+      (name: "X-BAR", value: "BAR"),
+    ])
+
+    func __perform(_ requestHeaderFields: Array<CURLHeaderField>?) async throws -> HTTPBinResponse? {
+      let delegate = CURLClientGeneralDelegate(
+        requestHeaderFields: requestHeaderFields,
+        preparedRequestHeaderFields: prepared
+      )
+      let client = try CURLManager.shared.makeEasyClient()
+      try await client.setHTTPMethodToGet()
+      try await client.setURL(try #require(URL(string: "https://httpcan.org/get")))
+      try await client.perform(delegate: delegate)
+      #expect(try #require(delegate.responseCode) == 200)
+      return try delegate.responseBody(as: Data.self).map {
+        try JSONDecoder().decode(HTTPBinResponse.self, from: $0)
+      }
+    }
+
+    let response1 = try await __perform(nil)
+    #expect(response1?.headerValue(for: "X-FOO") == "FOO")
+    #expect(response1?.headerValue(for: "X-BAR") == "BAR")
+
+    let response2 = try await __perform([(name: "X-BAZ", value: "BAZ")])
+    #expect(response2?.headerValue(for: "X-FOO") == "FOO")
+    #expect(response2?.headerValue(for: "X-BAR") == "BAR")
+    #expect(response2?.headerValue(for: "X-BAZ") == "BAZ")
+
+    let response3 = try await __perform([(name: "x-bar", value: "OVERRIDDEN")])
+    #expect(response3?.headerValue(for: "X-FOO") == "FOO")
+    #expect(response3?.headerValue(for: "X-BAR") == "OVERRIDDEN")
+
+    // The prepared list must be intact after layered requests.
+    let response4 = try await __perform(nil)
+    #expect(response4?.headerValue(for: "X-BAR") == "BAR")
+    #expect(response4?.headerValue(for: "X-BAZ") == nil)
+  }
+
+  @Test func test_preparedRequestHeaderStringsAreShared() throws {
+    let prepared = try CURLPreparedHeaderFieldList([
+      (name: "X-FOO", value: "FOO"),
+      (name: "X-BAR", value: "BAR"),
+      (name: "X-BAZ", value: "BAZ"),
+    ])
+
+    func __strings(_ list: UnsafePointer<CCURLStringList>?) -> Array<UnsafeMutablePointer<CChar>> {
+      var result: Array<UnsafeMutablePointer<CChar>> = []
+      var node = list
+      while let currentNode = node {
+        result.append(currentNode.pointee.data)
+        node = UnsafePointer(currentNode.pointee.next)
+      }
+      return result
+    }
+    let preparedStrings = __strings(prepared._list)
+
+    let delegatePointer = UnsafeMutablePointer<CURLClientGeneralDelegate>.allocate(capacity: 1)
+    delegatePointer.initialize(to: CURLClientGeneralDelegate(
+      requestHeaderFields: [(name: "x-bar", value: "OVERRIDDEN")],
+      preparedRequestHeaderFields: prepared
+    ))
+    defer {
+      delegatePointer.deinitialize(count: 1)
+      delegatePointer.deallocate()
+    }
+
+    do {
+      let userInfo = try _UserInfo(
+        delegatePointer: delegatePointer,
+        requestBodySize: nil,
+        maxNumberOfRedirectsAllowed: 0
+      )
+      let strings = __strings(try userInfo.requestHeaderFieldList)
+      #expect(strings.map({ String(cString: $0) }) == ["X-FOO: FOO", "X-BAZ: BAZ", "x-bar: OVERRIDDEN"])
+      #expect(Array(strings.prefix(2)) == [preparedStrings[0], preparedStrings[2]])
+    }
+
+    // The prepared list must be intact after the per-request list is released.
+    #expect(__strings(prepared._list) == preparedStrings)
+    #expect(preparedStrings.map({ String(cString: $0) }) == ["X-FOO: FOO", "X-BAR: BAR", "X-BAZ: BAZ"])
+  }
+
   @Test func test_simultaneousHTTPRequestsWithoutCURLMultiInterface() async throws {
     let urls: [String] = [
       "https://www.Apple.com/",
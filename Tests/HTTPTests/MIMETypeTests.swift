@@ -30,6 +30,50 @@ import Testing
     #expect(text_mime_type == MIMEType(type:.text, subtype:"plain"))
     #expect(text_mime_type?.possiblePathExtensions?.contains(txt_ext) == true)
   }
+
+  @Test func test_interning() throws {
+    let html = try #require(MIMEType("text/html; charset=UTF-8"))
+    #expect(html == MIMEType(type:.text, subtype:"html", parameters:["charset":"UTF-8"]))
+    #expect(html == MIMEType("TEXT/HTML; charset=UTF-8"))
+    #expect(html.description == "text/html; charset=UTF-8")
+    #expect(html.possiblePathExtensions == [.html, .htm])
+
+    var mutated = html
+    mutated.subtype = "plain"
+    #expect(mutated == MIMEType(pathExtension:"TXT", parameters:["charset":"UTF-8"]))
+    mutated.subtype = "not-interned"
+    #expect(mutated.possiblePathExtensions == nil)
+    #expect(mutated.description == "text/not-interned; charset=UTF-8")
+    #expect(mutated != MIMEType("text/plain; charset=UTF-8"))
+    mutated.subtype = "plain"
+    #expect(mutated == MIMEType("text/plain; charset=UTF-8"))
+  }
+
+  @Test func test_pathExtensionLookUp() {
+    #expect(MIMEType.PathExtension(rawValue:"html") == .html)
+    #expect(MIMEType.PathExtension(rawValue:"HTML") == nil)
+    #expect(MIMEType.PathExtension(rawValue:"") == nil)
+    #expect(MIMEType.PathExtension(caseInsensitiveString:"HTML") == .html)
+    #expect(MIMEType.PathExtension(caseInsensitiveString:"no-such-extension") == nil)
+    #expect(MIMEType(pathExtension:"Json") == MIMEType("application/json"))
+  }
+
+  @Test func test_allPathExtensions() {
+    for pathExtension in MIMEType.PathExtension.allCases {
+      #expect(MIMEType.PathExtension(rawValue:pathExtension.rawValue) == pathExtension)
+      #expect(MIMEType.PathExtension(caseInsensitiveString:pathExtension.rawValue.uppercased()) == pathExtension)
+    }
+    #expect(MIMEType.PathExtension(rawValue:"fe_launch") == .feLaunch)
+    #expect(MIMEType.PathExtension(rawValue:"n-gage") == .nGage)
+  }
+
+  @Test func test_allInternedMIMETypes() {
+    for (id, string) in _internedMIMETypeStrings.enumerated() {
+      #expect(_internedMIMETypeID(of:string.utf8) == UInt16(id))
+      #expect(_internedMIMETypeCores[id]._internedID == UInt16(id))
+      #expect(MIMEType(string)?.description == string)
+    }
+  }
 }
 #else
 import XCTest
@@ -55,5 +99,49 @@ final class MIMETypeTests: XCTestCase {
     XCTAssertEqual(text_mime_type, MIMEType(type:.text, subtype:"plain"))
     XCTAssertEqual(text_mime_type?.possiblePathExtensions?.contains(txt_ext), true)
   }
+  
+  func test_interning() throws {
+    let html = try XCTUnwrap(MIMEType("text/html; charset=UTF-8"))
+    XCTAssertEqual(html, MIMEType(type:.text, subtype:"html", parameters:["charset":"UTF-8"]))
+    XCTAssertEqual(html, MIMEType("TEXT/HTML; charset=UTF-8"))
+    XCTAssertEqual(html.description, "text/html; charset=UTF-8")
+    XCTAssertEqual(html.possiblePathExtensions, [.html, .htm])
+    
+    var mutated = html
+    mutated.subtype = "plain"
+    XCTAssertEqual(mutated, MIMEType(pathExtension:"TXT", parameters:["charset":"UTF-8"]))
+    mutated.subtype = "not-interned"
+    XCTAssertNil(mutated.possiblePathExtensions)
+    XCTAssertEqual(mutated.description, "text/not-interned; charset=UTF-8")
+    XCTAssertNotEqual(mutated, MIMEType("text/plain; charset=UTF-8"))
+    mutated.subtype = "plain"
+    XCTAssertEqual(mutated, MIMEType("text/plain; charset=UTF-8"))
+  }
+  
+  func test_pathExtensionLookUp() {
+    XCTAssertEqual(MIMEType.PathExtension(rawValue:"html"), .html)
+    XCTAssertNil(MIMEType.PathExtension(rawValue:"HTML"))
+    XCTAssertNil(MIMEType.PathExtension(rawValue:""))
+    XCTAssertEqual(MIMEType.PathExtension(caseInsensitiveString:"HTML"), .html)
+    XCTAssertNil(MIMEType.PathExtension(caseInsensitiveString:"no-such-extension"))
+    XCTAssertEqual(MIMEType(pathExtension:"Json"), MIMEType("application/json"))
+  }
+  
+  func test_allPathExtensions() {
+    for pathExtension in MIMEType.PathExtension.allCases {
+      XCTAssertEqual(MIMEType.PathExtension(rawValue:pathExtension.rawValue), pathExtension)
+      XCTAssertEqual(MIMEType.PathExtension(caseInsensitiveString:pathExtension.rawValue.uppercased()), pathExtension)
+    }
+    XCTAssertEqual(MIMEType.PathExtension(rawValue:"fe_launch"), .feLaunch)
+    XCTAssertEqual(MIMEType.PathExtension(rawValue:"n-gage"), .nGage)
+  }
+  
+  func test_allInternedMIMETypes() {
+    for (id, string) in _internedMIMETypeStrings.enumerated() {
+      XCTAssertEqual(_internedMIMETypeID(of:string.utf8), UInt16(id))
+      XCTAssertEqual(_internedMIMETypeCores[id]._internedID, UInt16(id))
+      XCTAssertEqual(MIMEType(string)?.description, string)
+    }
+  }
 }
 #endif
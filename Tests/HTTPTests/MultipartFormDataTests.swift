@@ -0,0 +1,181 @@
+/* *************************************************************************************************
+ MultipartFormDataTests.swift
+   © 2025 YOCKOW.
+     Licensed under MIT License.
+     See "LICENSE.txt" for more information.
+ ************************************************************************************************ */
+
+import _NetworkGearTestSupport
+import CURLClient
+import Foundation
+@testable import NetworkGear
+import Testing
+
+@Suite struct MultipartFormDataTests {
+  private func _readAll(_ sender: inout MultipartFormData.RequestBodySender, chunkSize: Int) -> Data? {
+    var result = Data()
+    let buffer = UnsafeMutablePointer<CChar>.allocate(capacity: chunkSize)
+    defer { buffer.deallocate() }
+    while true {
+      let count = sender.readNextPartialRequestBody(buffer, maxLength: chunkSize)
+      if count < 0 { return nil }
+      if count == 0 { break }
+      result.append(UnsafeRawPointer(buffer).assumingMemoryBound(to: UInt8.self), count: count)
+    }
+    return result
+  }
+
+  private func _parse(
+    _ data: Data,
+    boundary: String,
+    chunkSize: Int
+  ) throws -> [(header: HTTPHeader, content: Data)] {
+    var parts: [(header: HTTPHeader, content: Data)] = []
+    let parser = try MultipartParser(boundary: boundary) { event in
+      switch event {
+      case .partHeader(let header):
+        parts.append((header: header, content: Data()))
+      case .partContent(let bytes):
+        parts[parts.count - 1].content.append(contentsOf: bytes)
+      case .partEnd:
+        break
+      }
+    }
+    var index = data.startIndex
+    while index < data.endIndex {
+      let end = min(index + chunkSize, data.endIndex)
+      try parser.write(contentsOf: data[index..<end])
+      index = end
+    }
+    try parser.finish()
+    return parts
+  }
+
+  @Test func test_roundTrip() throws {
+    let fileURL = FileManager.default.temporaryDirectory.appendingPathComponent(
+      "MultipartFormDataTests-\(UUID().uuidString).txt"
+    )
+    let fileContent = String(repeating: "File Content\r\n", count: 1000)
+    try Data(fileContent.utf8).write(to: fileURL)
+    defer { try? FileManager.default.removeItem(at: fileURL) }
+
+    let multipart = try MultipartFormData(
+      boundary: "MultipartFormDataTestsBoundary",
+      parts: [
+        .init(name: "name1", value: "VALUE1"),
+        .init(name: "empty", value: ""),
+        .init(name: "file", fileURL: fileURL),
+        .init(name: "data", filename: "data.bin", contentType: .octetStream, data: Data([0x0D, 0x0A, 0x2D, 0x2D])),
+      ]
+    )
+    #expect(multipart.contentType.parameters?["boundary"] == "MultipartFormDataTestsBoundary")
+
+    var sender = multipart.makeRequestBodySender()
+    let body = try #require(_readAll(&sender, chunkSize: 100))
+    #expect(UInt64(body.count) == multipart.contentLength)
+
+    for chunkSize in [1, 7, 4096] {
+      let parts = try _parse(body, boundary: multipart.boundary, chunkSize: chunkSize)
+      try #require(parts.count == 4)
+      #expect(String(data: parts[0].content, encoding: .utf8) == "VALUE1")
+      #expect(parts[1].content.isEmpty)
+      #expect(String(data: parts[2].content, encoding: .utf8) == fileContent)
+      #expect(parts[2].header[.contentType].first?.value.rawValue == "text/plain")
+      #expect(parts[3].content == Data([0x0D, 0x0A, 0x2D, 0x2D]))
+
+      let disposition = try #require(parts[2].header[.contentDisposition].first.map({
+        ContentDisposition($0.value.rawValue)
+      }))
+      #expect(disposition.value == .formData)
+      #expect(disposition.parameters?["name"] == "file")
+      #expect(disposition.parameters?["filename"] == fileURL.lastPathComponent)
+    }
+
+    // Rewind
+    #expect(sender.rewindRequestBody(toOffset: 10))
+    #expect(_readAll(&sender, chunkSize: 33) == body.dropFirst(10))
+    #expect(!sender.rewindRequestBody(toOffset: UInt64(body.count) + 1))
+  }
+
+  @Test func test_parser_preambleAndEpilogue() throws {
+    let body = [
+      "This is the preamble.",
+      "--BOUNDARY",
+      "Content-Type: text/plain",
+      "",
+      "Hello,",
+      "--BOUNDARY  ",
+      "",
+      "World!",
+      "--BOUNDARY--",
+      "This is the epilogue.",
+    ].joined(separator: "\r\n")
+    let parts = try _parse(Data(body.utf8), boundary: "BOUNDARY", chunkSize: 3)
+    try #require(parts.count == 2)
+    #expect(parts[0].header[.contentType].first?.value.rawValue == "text/plain")
+    #expect(String(data: parts[0].content, encoding: .utf8) == "Hello,")
+    #expect(parts[1].header.count == 0)
+    #expect(String(data: parts[1].content, encoding: .utf8) == "World!")
+  }
+
+  @Test func test_parser_tooLargeHeader() throws {
+    let parser = try MultipartParser(boundary: "BOUNDARY") { _ in }
+    try parser.write(contentsOf: Data("--BOUNDARY\r\n".utf8))
+    let headerLine = Data("X-Foo: \(String(repeating: "A", count: 100))\r\n".utf8)
+    #expect(throws: MultipartParseError.tooLargeHeader) {
+      while true {
+        // Byte by byte: the header must not be rescanned from its start every time.
+        for byte in headerLine {
+          try parser.write(contentsOf: [byte])
+        }
+      }
+    }
+  }
+
+  @Test func test_parser_unexpectedEnd() throws {
+    let parser = try MultipartParser(boundary: "BOUNDARY") { _ in }
+    try parser.write(contentsOf: Data("--BOUNDARY\r\n\r\nContent".utf8))
+    #expect(throws: MultipartParseError.unexpectedEndOfBody) {
+      try parser.finish()
+    }
+  }
+
+  @Test func test_post() async throws {
+    let multipart = try MultipartFormData(parts: [
+      .init(name: "name1", value: "VALUE1"),
+      .init(name: "file", filename: "text.txt", contentType: MIMEType("text/plain"), data: Data("MY TEXT.".utf8)),
+    ])
+    let connection = SimpleHTTPConnection(
+      url: try #require(URL(string: "https://httpcan.org/redirect-to?url=%2Fpost&status_code=308")),
+      method: .post,
+      requestHeader: HTTPHeader(multipart.headerFields),
+      requestBody: .init(multipartFormData: multipart),
+      redirectStrategy: .followRedirects
+    )
+    let response = try await connection.response()
+    #expect(response.statusCode == .ok)
+    let httpbin = try JSONDecoder().decode(HTTPBinResponse.self, from: try #require(response.content))
+    #expect(httpbin.form?["name1"] == "VALUE1")
+    #expect(httpbin.files?["file"] == "MY TEXT.")
+  }
+
+  @Test func test_post_http1_1() async throws {
+    // libcurl would use chunked transfer encoding on HTTP/1.1 if it didn't know the body size.
+    let multipart = try MultipartFormData(parts: [
+      .init(name: "name1", value: "VALUE1"),
+    ])
+    let connection = SimpleHTTPConnection(
+      url: try #require(URL(string: "https://httpcan.org/post")),
+      method: .post,
+      requestHeader: HTTPHeader(multipart.headerFields),
+      requestBody: .init(multipartFormData: multipart),
+      httpVersion: .http1_1
+    )
+    let response = try await connection.response()
+    #expect(response.statusCode == .ok)
+    let httpbin = try JSONDecoder().decode(HTTPBinResponse.self, from: try #require(response.content))
+    #expect(httpbin.form?["name1"] == "VALUE1")
+    #expect(httpbin.headerValue(for: "Content-Length") == String(multipart.contentLength))
+    #expect(httpbin.headerValue(for: "Transfer-Encoding") == nil)
+  }
+}
@@ -0,0 +1,294 @@
+/* *************************************************************************************************
+ SegmentedHTTPDownloadTests.swift
+   © 2025 YOCKOW.
+     Licensed under MIT License.
+     See "LICENSE.txt" for more information.
+ ************************************************************************************************ */
+
+import CLibCURL
+import CURLClient
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+import Foundation
+@testable import NetworkGear
+import Testing
+
+private let _validator = "\"validator\""
+
+private func _temporaryDestination() -> URL {
+  return FileManager.default.temporaryDirectory.appendingPathComponent(
+    "SegmentedHTTPDownloadTests-\(UUID().uuidString).bin"
+  )
+}
+
+private func _download(_ destination: URL, maxNumberOfSegments: Int = 4) -> SegmentedHTTPDownload {
+  return SegmentedHTTPDownload(
+    url: URL(string: "https://example.com/resource.bin")!,
+    destination: destination,
+    maxNumberOfSegments: maxNumberOfSegments,
+    minimumSegmentSize: 1
+  )
+}
+
+/// Writes `byte` into the requested range as if it were the response body.
+private func _fakeTransfer(byte: UInt8) -> SegmentedHTTPDownload._Transfer {
+  return { (file, range, _, _, didWrite) in
+    let range = range ?? 0...7
+    let bytes = [UInt8](repeating: byte, count: range.count)
+    let result = pwrite(file.fileDescriptor, bytes, bytes.count, off_t(range.lowerBound))
+    #expect(result == bytes.count)
+    didWrite(UInt64(bytes.count))
+  }
+}
+
+private func _writeProgress(_ progress: SegmentedHTTPDownload._ProgressFile, to url: URL) throws {
+  try JSONEncoder().encode(progress).write(to: url)
+}
+
+@Suite struct SegmentedHTTPDownloadTests {
+  @Test func test_download() async throws {
+    let destination = FileManager.default.temporaryDirectory.appendingPathComponent(
+      "SegmentedHTTPDownloadTests-\(UUID().uuidString).txt"
+    )
+    defer { try? FileManager.default.removeItem(at: destination) }
+
+    let download = SegmentedHTTPDownload(
+      url: try #require(URL(string: "https://storage.googleapis.com/public.data.yockow.jp/test-assets/test.txt")),
+      destination: destination,
+      maxNumberOfSegments: 4,
+      minimumSegmentSize: 1
+    )
+    try await download.perform()
+
+    #expect(try String(contentsOf: destination, encoding: .utf8) == "test")
+    #expect(!FileManager.default.fileExists(atPath: download.progressFileURL.path))
+  }
+
+  @Test func test_validator() {
+    let lastModified = "Sun, 06 Nov 1994 08:49:37 GMT"
+
+    // A strong entity tag is preferred.
+    #expect(SegmentedHTTPDownload._validator(in: [
+      (name: "etag", value: "\"strong\""),
+      (name: "Last-Modified", value: lastModified),
+      (name: "Date", value: "Mon, 07 Nov 1994 08:49:37 GMT"),
+    ]) == "\"strong\"")
+
+    // A date must not be sent in place of a weak entity tag.
+    #expect(SegmentedHTTPDownload._validator(in: [
+      (name: "ETag", value: "W/\"weak\""),
+      (name: "Last-Modified", value: lastModified),
+      (name: "Date", value: "Mon, 07 Nov 1994 08:49:37 GMT"),
+    ]) == nil)
+
+    // "Last-Modified" is strong only if "Date" is at least one second later.
+    #expect(SegmentedHTTPDownload._validator(in: [
+      (name: "Last-Modified", value: lastModified),
+      (name: "Date", value: "Sun, 06 Nov 1994 08:49:38 GMT"),
+    ]) == lastModified)
+    #expect(SegmentedHTTPDownload._validator(in: [
+      (name: "Last-Modified", value: lastModified),
+      (name: "Date", value: lastModified),
+    ]) == nil)
+    #expect(SegmentedHTTPDownload._validator(in: [
+      (name: "Last-Modified", value: lastModified),
+    ]) == nil)
+    #expect(SegmentedHTTPDownload._validator(in: []) == nil)
+  }
+
+  @Test func test_newProgress() {
+    let download = SegmentedHTTPDownload(
+      url: URL(string: "https://example.com/resource.bin")!,
+      destination: _temporaryDestination(),
+      maxNumberOfSegments: 4,
+      minimumSegmentSize: 1
+    )
+    #expect(download._newProgress(contentLength: 10, validator: _validator).segments.map({ $0.start...$0.end }) == [
+      0...2, 3...5, 6...8, 9...9,
+    ])
+    #expect(download._newProgress(contentLength: 3, validator: _validator).segments.map({ $0.start...$0.end }) == [
+      0...0, 1...1, 2...2,
+    ])
+    #expect(download._newProgress(contentLength: 0, validator: _validator).segments.isEmpty)
+
+    let largeSegments = SegmentedHTTPDownload(
+      url: URL(string: "https://example.com/resource.bin")!,
+      destination: _temporaryDestination(),
+      maxNumberOfSegments: 4,
+      minimumSegmentSize: 4
+    )
+    #expect(largeSegments._newProgress(contentLength: 10, validator: _validator).segments.map({ $0.start...$0.end }) == [
+      0...3, 4...7, 8...9,
+    ])
+  }
+
+  @Test func test_loadProgress() throws {
+    let destination = _temporaryDestination()
+    let download = _download(destination)
+    defer {
+      try? FileManager.default.removeItem(at: destination)
+      try? FileManager.default.removeItem(at: download.progressFileURL)
+    }
+    let probe = SegmentedHTTPDownload._Probe(contentLength: 8, acceptsRanges: true, validator: _validator)
+    let progress = download._newProgress(contentLength: 8, validator: _validator)
+    try _writeProgress(progress, to: download.progressFileURL)
+
+    // The destination doesn't exist.
+    #expect(download._loadProgress(probe: probe) == nil)
+
+    try Data(count: 8).write(to: destination)
+    #expect(download._loadProgress(probe: probe) == progress)
+
+    var modifiedProbe = probe
+    modifiedProbe.validator = "\"modified\""
+    #expect(download._loadProgress(probe: modifiedProbe) == nil)
+    modifiedProbe = probe
+    modifiedProbe.contentLength = 9
+    #expect(download._loadProgress(probe: modifiedProbe) == nil)
+  }
+
+  @Test func test_resume() async throws {
+    let destination = _temporaryDestination()
+    let download = _download(destination, maxNumberOfSegments: 2)
+    defer { try? FileManager.default.removeItem(at: destination) }
+
+    // The first segment is complete and the second one is half done.
+    try Data("ABCDEF\0\0".utf8).write(to: destination)
+    try _writeProgress(.init(
+      url: download.url.absoluteString,
+      contentLength: 8,
+      validator: _validator,
+      segments: [
+        .init(start: 0, end: 3, completed: 4),
+        .init(start: 4, end: 7, completed: 2),
+      ]
+    ), to: download.progressFileURL)
+
+    try await download._perform(
+      probe: .init(contentLength: 8, acceptsRanges: true, validator: _validator),
+      transfer: _fakeTransfer(byte: 0x59)
+    )
+    #expect(try Data(contentsOf: destination) == Data("ABCDEFYY".utf8))
+    #expect(!FileManager.default.fileExists(atPath: download.progressFileURL.path))
+  }
+
+  @Test func test_validatorChanged() async throws {
+    let destination = _temporaryDestination()
+    let download = _download(destination)
+    defer {
+      try? FileManager.default.removeItem(at: destination)
+      try? FileManager.default.removeItem(at: download.progressFileURL)
+    }
+
+    await #expect(throws: SegmentedHTTPDownload.Error.validatorChanged) {
+      try await download._perform(
+        probe: .init(contentLength: 8, acceptsRanges: true, validator: _validator),
+        transfer: { _, _, _, _, _ in throw SegmentedHTTPDownload.Error.validatorChanged }
+      )
+    }
+    #expect(!FileManager.default.fileExists(atPath: download.progressFileURL.path))
+  }
+
+  @Test func test_fallback() async throws {
+    let destination = _temporaryDestination()
+    let download = _download(destination)
+    defer { try? FileManager.default.removeItem(at: destination) }
+
+    // Stale progress must be discarded.
+    try _writeProgress(
+      download._newProgress(contentLength: 8, validator: _validator),
+      to: download.progressFileURL
+    )
+    try await download._perform(
+      probe: .init(contentLength: 8, acceptsRanges: false, validator: _validator),
+      transfer: { (file, range, validator, abortFlag, didWrite) in
+        #expect(range == nil)
+        #expect(validator == nil)
+        try await _fakeTransfer(byte: 0x5A)(file, range, validator, abortFlag, didWrite)
+      }
+    )
+    #expect(try Data(contentsOf: destination) == Data("ZZZZZZZZ".utf8))
+    #expect(!FileManager.default.fileExists(atPath: download.progressFileURL.path))
+  }
+
+  @Test func test_abort() async throws {
+    let destination = _temporaryDestination()
+    let download = _download(destination, maxNumberOfSegments: 2)
+    defer {
+      try? FileManager.default.removeItem(at: destination)
+      try? FileManager.default.removeItem(at: download.progressFileURL)
+    }
+
+    // The second segment would never finish unless it is aborted.
+    await #expect(throws: SegmentedHTTPDownload.Error.incompleteSegment) {
+      try await download._perform(
+        probe: .init(contentLength: 8, acceptsRanges: true, validator: _validator),
+        transfer: { (_, range, _, abortFlag, _) in
+          if range?.lowerBound == 0 {
+            throw SegmentedHTTPDownload.Error.incompleteSegment
+          }
+          while !abortFlag.isAborted && !Task.isCancelled {
+            try? await Task.sleep(nanoseconds: 1_000_000)
+          }
+          throw CancellationError()
+        }
+      )
+    }
+    // Progress is kept for resumption.
+    #expect(FileManager.default.fileExists(atPath: download.progressFileURL.path))
+  }
+
+  @Test func test_segmentDelegate() throws {
+    let destination = _temporaryDestination()
+    defer { try? FileManager.default.removeItem(at: destination) }
+    let file = try SegmentedHTTPDownload._File(destination, truncatingTo: 8)
+    let client = try CURLManager.shared.makeEasyClient()
+
+    func __write(_ delegate: SegmentedHTTPDownload._SegmentDelegate, _ string: String) -> CSize {
+      var bytes = Array(string.utf8).map({ CChar(bitPattern: $0) })
+      return bytes.withUnsafeMutableBufferPointer {
+        delegate.writeNextPartialResponseBody($0.baseAddress!, length: $0.count)
+      }
+    }
+
+    func __delegate(abortFlag: SegmentedHTTPDownload._AbortFlag = .init()) throws -> SegmentedHTTPDownload._SegmentDelegate {
+      let delegate = SegmentedHTTPDownload._SegmentDelegate(
+        file: file,
+        range: 2...5,
+        abortFlag: abortFlag,
+        requestHeaderFields: [],
+        preparedRequestHeaderFields: nil,
+        didWrite: { _ in }
+      )
+      // Pretend to be performed by `client`.
+      try delegate.willStartPerforming(client: client)
+      return delegate
+    }
+
+    // "If-Range" didn't match.
+    let mismatched = try __delegate()
+    mismatched.setResponseCode(200)
+    #expect(__write(mismatched, "ABCDEFGH") == -1)
+    #expect(mismatched.failure as? SegmentedHTTPDownload.Error == .validatorChanged)
+
+    let matched = try __delegate()
+    matched.setResponseCode(206)
+    matched.appendResponseHeaderField((name: "Content-Range", value: "bytes 2-5/8"))
+    #expect(__write(matched, "CD") == 2)
+    #expect(__write(matched, "EF") == 2)
+    #expect(matched.offset == 6)
+    #expect(try Data(contentsOf: destination) == Data("\0\0CDEF\0\0".utf8))
+
+    let abortFlag = SegmentedHTTPDownload._AbortFlag()
+    let aborted = try __delegate(abortFlag: abortFlag)
+    aborted.setResponseCode(206)
+    aborted.appendResponseHeaderField((name: "Content-Range", value: "bytes 2-5/8"))
+    #expect(__write(aborted, "C") == 1)
+    abortFlag.abort(with: SegmentedHTTPDownload.Error.incompleteSegment)
+    #expect(__write(aborted, "D") == -1)
+    #expect(aborted.failure is CancellationError)
+  }
+}
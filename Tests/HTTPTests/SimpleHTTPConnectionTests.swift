@@ -70,4 +70,31 @@ import Testing
     let httpbin = try JSONDecoder().decode(HTTPBinResponse.self, from: content as Data)
     #expect(httpbin.form?["foo"] == "bar")
   }
+
+  @Test func test_preparedHeader() async throws {
+    let url = try #require(URL(string: "https://httpcan.org/get"))
+    let preparedHeader = try PreparedHTTPHeader([
+      HTTPHeaderField(name: "X-Foo", value: "FOO"),
+      HTTPHeaderField(name: "X-Bar", value: "BAR"),
+    ])
+
+    func __response(_ requestHeader: HTTPHeader) async throws -> HTTPBinResponse {
+      let connection = SimpleHTTPConnection(
+        url: url,
+        requestHeader: requestHeader,
+        preparedRequestHeader: preparedHeader
+      )
+      let response = try await connection.response()
+      #expect(response.statusCode == .ok)
+      return try JSONDecoder().decode(HTTPBinResponse.self, from: try #require(response.content))
+    }
+
+    let httpbin1 = try await __response([])
+    #expect(httpbin1.headerValue(for: "X-Foo") == "FOO")
+    #expect(httpbin1.headerValue(for: "X-Bar") == "BAR")
+
+    let httpbin2 = try await __response([HTTPHeaderField(name: "X-Bar", value: "OVERRIDDEN")])
+    #expect(httpbin2.headerValue(for: "X-Foo") == "FOO")
+    #expect(httpbin2.headerValue(for: "X-Bar") == "OVERRIDDEN")
+  }
 }
@@ -38,6 +38,87 @@ private extension MIMEType {
   }
 }
 
+/// Minimal perfect hash table built by "hash and displace" method.
+///
+/// The hash function must be identical to `_MIMETypePerfectHasher` in "NetworkGear" module.
+private struct _PerfectHashTable {
+  private static func _hash(_ key: String) -> UInt64 {
+    // FNV-1a (ASCII case-insensitive)
+    var value: UInt64 = 0xCBF29CE484222325
+    for byte in key.utf8 {
+      let folded = (0x41...0x5A).contains(byte) ? byte | 0x20 : byte
+      value = (value ^ UInt64(folded)) &* 0x100000001B3
+    }
+    return value
+  }
+  
+  private static func _bucket(of hash: UInt64, numberOfBuckets: Int) -> Int {
+    return Int((hash >> 32) % UInt64(numberOfBuckets))
+  }
+  
+  private static func _slot(of hash: UInt64, displacement: UInt32, numberOfSlots: Int) -> Int {
+    // MurmurHash3's finalizer
+    var mixed = UInt32(truncatingIfNeeded: hash) ^ displacement
+    mixed ^= mixed >> 16
+    mixed &*= 0x85EBCA6B
+    mixed ^= mixed >> 13
+    mixed &*= 0xC2B2AE35
+    mixed ^= mixed >> 16
+    return Int(mixed % UInt32(numberOfSlots))
+  }
+  
+  let displacements: [UInt32]
+  
+  /// Indices of keys placed in each slot.
+  let slots: [Int]
+  
+  init(keys: [String]) {
+    precondition(!keys.isEmpty && Set(keys).count == keys.count, "Keys must be unique.")
+    let numberOfBuckets = max(1, (keys.count + 1) / 2)
+    let hashes = keys.map(_PerfectHashTable._hash)
+    var buckets: [[Int]] = .init(repeating: [], count: numberOfBuckets)
+    for (keyIndex, hash) in hashes.enumerated() {
+      buckets[_PerfectHashTable._bucket(of: hash, numberOfBuckets: numberOfBuckets)].append(keyIndex)
+    }
+    
+    var displacements: [UInt32] = .init(repeating: 0, count: numberOfBuckets)
+    var slots: [Int?] = .init(repeating: nil, count: keys.count)
+    // Larger buckets first.
+    let sortedBucketIndices = buckets.indices.sorted {
+      if buckets[$0].count != buckets[$1].count {
+        return buckets[$0].count > buckets[$1].count
+      }
+      return $0 < $1
+    }
+    for bucketIndex in sortedBucketIndices where !buckets[bucketIndex].isEmpty {
+      var displacement: UInt32 = 0
+      searchDisplacement: while true {
+        let candidates = buckets[bucketIndex].map {
+          _PerfectHashTable._slot(of: hashes[$0], displacement: displacement, numberOfSlots: keys.count)
+        }
+        guard Set(candidates).count == candidates.count, candidates.allSatisfy({ slots[$0] == nil }) else {
+          displacement += 1
+          continue searchDisplacement
+        }
+        for (keyIndex, slot) in zip(buckets[bucketIndex], candidates) {
+          slots[slot] = keyIndex
+        }
+        displacements[bucketIndex] = displacement
+        break searchDisplacement
+      }
+    }
+    
+    self.displacements = displacements
+    self.slots = slots.map({ $0! })
+    
+    for (keyIndex, hash) in hashes.enumerated() {
+      let bucket = _PerfectHashTable._bucket(of: hash, numberOfBuckets: numberOfBuckets)
+      let slot = _PerfectHashTable._slot(of: hash, displacement: displacements[bucket], numberOfSlots: keys.count)
+      precondition(self.slots[slot] == keyIndex, "\(keys[keyIndex].debugDescription) is not placed in its own slot.")
+    }
+  }
+}
+
 public struct _TypeExt: Equatable {
   public let mimeType: MIMEType
   public let extensions: ArraySlice<Substring>
@@ -125,10 +206,17 @@ public final class MIMETypePathExtension: CodeUpdaterDelegate {
     
     do { // enum
       lines.append("extension MIMEType {")
-      lines.append(String.Line("public enum PathExtension: String, Sendable {", indentLevel: 1)!)
+      lines.append(String.Line("public enum PathExtension: String, CaseIterable, Sendable {", indentLevel: 1)!)
       for ext in sortedExtensions {
         lines.append(String.Line(" case \(_extIdentifier(of: ext)) = \(ext.debugDescription)", indentLevel: 2)!)
       }
+      lines.appendEmptyLine()
+      lines.append(String.Line("public init?(rawValue: String) {", indentLevel: 2)!)
+      lines.append(String.Line("guard let pathExtension = PathExtension._lookUp(rawValue.utf8, caseSensitive: true) else {", indentLevel: 3)!)
+      lines.append(String.Line("return nil", indentLevel: 4)!)
+      lines.append(String.Line("}", indentLevel: 3)!)
+      lines.append(String.Line("self = pathExtension", indentLevel: 3)!)
+      lines.append(String.Line("}", indentLevel: 2)!)
       lines.append(String.Line("}", indentLevel: 1)!)
       lines.append("}")
       lines.appendEmptyLine()
@@ -144,23 +232,78 @@ public final class MIMETypePathExtension: CodeUpdaterDelegate {
       return result
     }
     
-    do { // MIMEType -> PathExtension
-      lines.append("internal let _mimeType_to_ext: [MIMEType._Core: Set<MIMEType.PathExtension>] = [")
+    func _appendNumbers<T>(_ numbers: [T]) where T: BinaryInteger {
+      for ii in stride(from: 0, to: numbers.count, by: 16) {
+        let line = numbers[ii..<min(ii + 16, numbers.count)].map({ "\($0)," }).joined(separator: " ")
+        lines.append(String.Line(line, indentLevel: 1)!)
+      }
+    }
+    
+    // Index of `sortedMIMETypes` is used as the interned ID.
+    let mimeTypeIDs: [MIMEType: Int] = .init(uniqueKeysWithValues: sortedMIMETypes.enumerated().map({ ($1, $0) }))
+    
+    do { // PathExtension -> MIMEType
+      lines.append("extension MIMEType.PathExtension {")
+      lines.append(String.Line("internal var _internedMIMETypeID: UInt16 {", indentLevel: 1)!)
+      lines.append(String.Line("switch self {", indentLevel: 2)!)
+      for ext in sortedExtensions {
+        let id = mimeTypeIDs[extToMIMEType[ext]!]!
+        lines.append(String.Line("case .\(_extIdentifier(of: ext)): return \(id)", indentLevel: 2)!)
+      }
+      lines.append(String.Line("}", indentLevel: 2)!)
+      lines.append(String.Line("}", indentLevel: 1)!)
+      lines.append("}")
+      lines.appendEmptyLine()
+    }
+    
+    do { // Interned MIME types
+      lines.append("internal let _internedMIMETypeCores: [MIMEType._Core] = [")
+      for mimeType in sortedMIMETypes {
+        lines.append(String.Line("\(_mimeTypeCoreDescription(of: mimeType)),", indentLevel: 1)!)
+      }
+      lines.append("]")
+      lines.appendEmptyLine()
+      
+      lines.append("internal let _internedMIMETypeStrings: [String] = [")
+      for mimeType in sortedMIMETypes {
+        lines.append(String.Line("\(mimeType.description.debugDescription),", indentLevel: 1)!)
+      }
+      lines.append("]")
+      lines.appendEmptyLine()
+      
+      lines.append("internal let _internedMIMETypePathExtensions: [Set<MIMEType.PathExtension>] = [")
       for mimeType in sortedMIMETypes {
         let extensions = mimeTypeToExt[mimeType]!
-        let mimeTypeDesc = _mimeTypeCoreDescription(of: mimeType)
         let extDesc = "[" + extensions.map({ "." + _extIdentifier(of: $0) }).joined(separator: ", ") + "]"
-        lines.append(String.Line("\(mimeTypeDesc): \(extDesc),", indentLevel: 1)!)
+        lines.append(String.Line("\(extDesc),", indentLevel: 1)!)
       }
       lines.append("]")
+      lines.appendEmptyLine()
     }
     
-    do { // PathExtension -> MIMEType
-      lines.append("internal let _ext_to_mimeType: [MIMEType.PathExtension: MIMEType._Core] = [")
-      for ext in sortedExtensions {
-        let mimeType = extToMIMEType[ext]!
-        let mimeTypeDesc = _mimeTypeCoreDescription(of: mimeType)
-        lines.append(String.Line(".\(_extIdentifier(of: ext)): \(mimeTypeDesc),", indentLevel: 1)!)
+    do { // MIME type string -> interned ID
+      let table = _PerfectHashTable(keys: sortedMIMETypes.map(\.description))
+      lines.append("internal let _internedMIMETypeHashDisplacements: [UInt32] = [")
+      _appendNumbers(table.displacements)
+      lines.append("]")
+      lines.appendEmptyLine()
+      
+      lines.append("internal let _internedMIMETypeHashSlots: [UInt16] = [")
+      _appendNumbers(table.slots)
+      lines.append("]")
+      lines.appendEmptyLine()
+    }
+    
+    do { // Path extension string -> PathExtension
+      let table = _PerfectHashTable(keys: sortedExtensions)
+      lines.append("internal let _pathExtensionHashDisplacements: [UInt32] = [")
+      _appendNumbers(table.displacements)
+      lines.append("]")
+      lines.appendEmptyLine()
+      
+      lines.append("internal let _pathExtensionHashSlots: [MIMEType.PathExtension] = [")
+      for keyIndex in table.slots {
+        lines.append(String.Line(".\(_extIdentifier(of: sortedExtensions[keyIndex])),", indentLevel: 1)!)
       }
       lines.append("]")
     }
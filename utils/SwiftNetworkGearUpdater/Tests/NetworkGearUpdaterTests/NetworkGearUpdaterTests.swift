@@ -67,8 +67,11 @@ import Testing
   @Test func test_MIMETypePathExtension() throws {
     let lines = try _lines(with: MIMETypePathExtension())
     #expect(lines._contains(line: "case text = \"text\""))
-    #expect(lines._contains(line: "MIMEType._Core(type: .text, tree: nil, subtype: \"html\", suffix: nil): [.html, .htm],"))
-    #expect(lines._contains(line: ".aiff: MIMEType._Core(type: .audio, tree: nil, subtype: \"x-aiff\", suffix: nil),"))
+    #expect(lines._contains(line: "public enum PathExtension: String, CaseIterable, Sendable {"))
+    #expect(lines._contains(line: "public init?(rawValue: String) {"))
+    #expect(lines._contains(line: "MIMEType._Core(type: .text, tree: nil, subtype: \"html\", suffix: nil),"))
+    #expect(lines._contains(line: "\"text/html\","))
+    #expect(lines._contains(line: "[.html, .htm],"))
   }
 }
 #else
@@ -107,8 +110,11 @@ final class NetworkGearUpdaterTests: XCTestCase {
   func test_MIMETypePathExtension() throws {
     let lines = try _lines(with: MIMETypePathExtension())
     XCTAssertTrue(lines._contains(line: "case text = \"text\""))
-    XCTAssertTrue(lines._contains(line: "MIMEType._Core(type: .text, tree: nil, subtype: \"html\", suffix: nil): [.html, .htm],"))
-    XCTAssertTrue(lines._contains(line: ".aiff: MIMEType._Core(type: .audio, tree: nil, subtype: \"x-aiff\", suffix: nil),"))
+    XCTAssertTrue(lines._contains(line: "public enum PathExtension: String, CaseIterable, Sendable {"))
+    XCTAssertTrue(lines._contains(line: "public init?(rawValue: String) {"))
+    XCTAssertTrue(lines._contains(line: "MIMEType._Core(type: .text, tree: nil, subtype: \"html\", suffix: nil),"))
+    XCTAssertTrue(lines._contains(line: "\"text/html\","))
+    XCTAssertTrue(lines._contains(line: "[.html, .htm],"))
   }
 }
 #endif